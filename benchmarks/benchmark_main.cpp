@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include "perf_counters.h"
+
 int main(int argc, char** argv) {
+  disruptor::bench::parsePerfCounterFlag(argc, argv);
   benchmark::Initialize(&argc, argv);
   if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
     return 1;
@@ -2,6 +2,7 @@
 
 #include "jmh_config.h"
 #include "jmh_util.h"
+#include "perf_counters.h"
 
 #include <atomic>
 #include <chrono>
@@ -95,6 +96,7 @@ static void JMH_BlockingQueueBenchmark_producing(benchmark::State& state) {
   auto started_f = started.get_future();
 
   std::thread consumer([&] {
+    disruptor::bench::ConsumerThreadRegistration perfRegistration;
     started.set_value();
     while (consumerRunning.load(std::memory_order_acquire)) {
       auto* ev = q.poll();
@@ -109,12 +111,14 @@ static void JMH_BlockingQueueBenchmark_producing(benchmark::State& state) {
   disruptor::bench::jmh::SimpleEvent e{};
   e.value = 0;
 
+  disruptor::bench::PerfCounterCollector perfCounters(state, /*consumerThreads=*/1);
   for (auto _ : state) {
     if (!q.offer(&e, std::chrono::seconds(1))) {
       state.SkipWithError("Queue full, benchmark should not experience backpressure");
       break;
     }
   }
+  perfCounters.report();
 
   consumerRunning.store(false, std::memory_order_release);
   q.stop();
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/InsufficientCapacityException.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+// Cost of rejecting a claim on a full ring: the exception-based tryNext()
+// against the std::optional-based tryClaim(), for load-shedding producers that
+// hit a full ring on every attempt.
+
+namespace {
+constexpr int kRingBufferSize = 1024;
+
+using SingleProducerRing =
+    disruptor::SingleProducerRingBuffer<disruptor::bench::jmh::SimpleEvent, disruptor::BusySpinWaitStrategy>;
+using MultiProducerRing =
+    disruptor::MultiProducerRingBuffer<disruptor::bench::jmh::SimpleEvent, disruptor::BusySpinWaitStrategy>;
+
+template <bool kMultiProducer>
+struct FullRing {
+  using RingBufferT = std::conditional_t<kMultiProducer, MultiProducerRing, SingleProducerRing>;
+
+  disruptor::BusySpinWaitStrategy ws;
+  std::shared_ptr<RingBufferT> ringBuffer;
+  // Never advanced, so once filled the ring stays full.
+  disruptor::Sequence gating;
+
+  FullRing() {
+    auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+    if constexpr (kMultiProducer) {
+      ringBuffer = RingBufferT::createMultiProducer(factory, kRingBufferSize, ws);
+    } else {
+      ringBuffer = RingBufferT::createSingleProducer(factory, kRingBufferSize, ws);
+    }
+    ringBuffer->addGatingSequences(gating);
+    ringBuffer->publish(ringBuffer->next(kRingBufferSize));
+  }
+};
+
+void reportRejections(benchmark::State &state, int64_t rejections) {
+  state.counters["rejections_per_op"] = benchmark::Counter(
+      static_cast<double>(rejections) / static_cast<double>(state.iterations()));
+}
+
+template <bool kMultiProducer>
+void FullRingRejection_tryNextThrow(benchmark::State &state) {
+  FullRing<kMultiProducer> full;
+  int64_t rejections = 0;
+  for (auto _ : state) {
+    try {
+      benchmark::DoNotOptimize(full.ringBuffer->tryNext());
+    } catch (const disruptor::InsufficientCapacityException &) {
+      ++rejections;
+    }
+  }
+  reportRejections(state, rejections);
+}
+
+template <bool kMultiProducer>
+void FullRingRejection_tryClaim(benchmark::State &state) {
+  FullRing<kMultiProducer> full;
+  int64_t rejections = 0;
+  for (auto _ : state) {
+    const std::optional<int64_t> claimed = full.ringBuffer->tryClaim();
+    benchmark::DoNotOptimize(claimed);
+    if (!claimed) {
+      ++rejections;
+    }
+  }
+  reportRejections(state, rejections);
+}
+
+template <bool kMultiProducer>
+void FullRingRejection_tryPublishEvent(benchmark::State &state) {
+  FullRing<kMultiProducer> full;
+  disruptor::bench::jmh::SetZeroTranslator translator;
+  int64_t rejections = 0;
+  for (auto _ : state) {
+    if (!full.ringBuffer->tryPublishEvent(translator)) {
+      ++rejections;
+    }
+  }
+  reportRejections(state, rejections);
+}
+} // namespace
+
+static auto *bm_FullRingRejection = [] {
+  using disruptor::bench::jmh::applyJmhDefaults;
+  applyJmhDefaults(benchmark::RegisterBenchmark("JMH_FullRingRejection_tryNextThrow/SP",
+                                                &FullRingRejection_tryNextThrow<false>));
+  applyJmhDefaults(benchmark::RegisterBenchmark("JMH_FullRingRejection_tryNextThrow/MP",
+                                                &FullRingRejection_tryNextThrow<true>));
+  applyJmhDefaults(benchmark::RegisterBenchmark("JMH_FullRingRejection_tryClaim/SP",
+                                                &FullRingRejection_tryClaim<false>));
+  applyJmhDefaults(benchmark::RegisterBenchmark("JMH_FullRingRejection_tryClaim/MP",
+                                                &FullRingRejection_tryClaim<true>));
+  applyJmhDefaults(benchmark::RegisterBenchmark("JMH_FullRingRejection_tryPublishEvent/SP",
+                                                &FullRingRejection_tryPublishEvent<false>));
+  return applyJmhDefaults(benchmark::RegisterBenchmark(
+      "JMH_FullRingRejection_tryPublishEvent/MP", &FullRingRejection_tryPublishEvent<true>));
+}();
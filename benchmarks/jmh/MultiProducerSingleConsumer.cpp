@@ -2,6 +2,7 @@
 
 #include "jmh_config.h"
 #include "jmh_util.h"
+#include "perf_counters.h"
 
 #include "disruptor/BusySpinWaitStrategy.h"
 #include "disruptor/TimeoutException.h"
@@ -121,12 +122,14 @@ static void JMH_MultiProducerSingleConsumer_producing(benchmark::State& state) {
   //   SimpleEvent e = ringBuffer.get(sequence);
   //   e.setValue(0);
   //   ringBuffer.publish(sequence);
+  disruptor::bench::PerfCounterCollector perfCounters(state, /*consumerThreads=*/1);
   for (auto _ : state) {
     const int64_t sequence = g_ringBuffer->next();
     auto& e = g_ringBuffer->get(sequence);
     e.value = 0;
     g_ringBuffer->publish(sequence);
   }
+  perfCounters.report();
 }
 
 static auto* bm_JMH_MultiProducerSingleConsumer_producing = [] {
@@ -221,6 +224,7 @@ static void JMH_MultiProducerSingleConsumer_producingBatch(benchmark::State& sta
     return;
   }
 
+  disruptor::bench::PerfCounterCollector perfCounters(state, /*consumerThreads=*/1);
   for (auto _ : state) {
     int64_t hi = g_batch_ringBuffer->next(kBatchSize);
     int64_t lo = hi - (kBatchSize - 1);
@@ -230,6 +234,7 @@ static void JMH_MultiProducerSingleConsumer_producingBatch(benchmark::State& sta
     }
     g_batch_ringBuffer->publish(lo, hi);
   }
+  perfCounters.report();
 
   // JMH: @OperationsPerInvocation(BATCH_SIZE)
   state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
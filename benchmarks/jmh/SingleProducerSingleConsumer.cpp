@@ -2,6 +2,7 @@
 
 #include "jmh_config.h"
 #include "jmh_util.h"
+#include "perf_counters.h"
 
 #include "disruptor/BusySpinWaitStrategy.h"
 #include "disruptor/RingBuffer.h"
@@ -36,12 +37,14 @@ JMH_SingleProducerSingleConsumer_producing(benchmark::State &state) {
   //   SimpleEvent e = ringBuffer.get(sequence);
   //   e.setValue(0);
   //   ringBuffer.publish(sequence);
+  disruptor::bench::PerfCounterCollector perfCounters(state);
   for (auto _ : state) {
     const int64_t sequence = rb->next();
     auto &e = rb->get(sequence);
     e.value = 0;
     rb->publish(sequence);
   }
+  perfCounters.report();
 
   const auto wait_entries_after =
       disruptor::sp_wrap_wait_entries().load(std::memory_order_relaxed);
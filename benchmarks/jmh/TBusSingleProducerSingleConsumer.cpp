@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include "jmh_config.h"
+#include "perf_counters.h"
 
 #include <cstdint>
 #include <cstring>
@@ -31,6 +32,7 @@ static void JMH_TBusSingleProducerSingleConsumer_producing(benchmark::State& sta
   volatile bool running = true;
 
   std::thread consumer([&] {
+    disruptor::bench::ConsumerThreadRegistration perfRegistration;
     uint64_t v = 0;
     struct iovec iov[8];
     while (running) {
@@ -48,6 +50,7 @@ static void JMH_TBusSingleProducerSingleConsumer_producing(benchmark::State& sta
   });
 
   uint64_t payload = 0;
+  disruptor::bench::PerfCounterCollector perfCounters(state, /*consumerThreads=*/1);
   for (auto _ : state) {
     char* buf = nullptr;
     while (tbus_send_begin(tb, &buf) == 0) {
@@ -57,6 +60,7 @@ static void JMH_TBusSingleProducerSingleConsumer_producing(benchmark::State& sta
     tbus_send_end(tb, static_cast<tbus_atomic_size_t>(sizeof(payload)));
     ++payload;
   }
+  perfCounters.report();
 
   running = false;
   consumer.join();
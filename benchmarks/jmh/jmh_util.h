@@ -7,7 +7,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include "perf_counters.h"
+
 #include <cstdint>
+#include <optional>
 
 namespace disruptor::bench::jmh {
 
@@ -21,10 +24,16 @@ struct SimpleEventFactory final : public disruptor::EventFactory<SimpleEvent> {
 };
 
 // Equivalent of com.lmax.disruptor.util.SimpleEventHandler (consumes via Blackhole).
+// Registers its processor thread so PerfCounterCollector can count it.
 struct ConsumeHandler final : public disruptor::EventHandler<SimpleEvent> {
   void onEvent(SimpleEvent& e, int64_t /*sequence*/, bool /*endOfBatch*/) override {
     benchmark::DoNotOptimize(e.value);
   }
+
+  void onStart() override { perfRegistration.emplace(); }
+  void onShutdown() override { perfRegistration.reset(); }
+
+  std::optional<disruptor::bench::ConsumerThreadRegistration> perfRegistration;
 };
 
 // Equivalent of setValue(0)
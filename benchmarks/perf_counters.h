@@ -0,0 +1,361 @@
+#pragma once
+// Hardware performance counters for the benchmark harness (Linux perf_event_open).
+//
+// Usage inside a benchmark body:
+//
+//   disruptor::bench::PerfCounterCollector counters(state, /*consumerThreads=*/1);
+//   for (auto _ : state) { ... }
+//   counters.report();
+//
+// The collector counts the calling (producer) thread and every thread that
+// registered itself as a consumer via ConsumerThreadRegistration, and reports
+// per-operation values as Google Benchmark counters:
+//   producer_<event>_per_op / consumer_<event>_per_op
+//
+// Collection is off unless the binary is run with --disruptor_perf_counters
+// (see benchmark_main.cpp). Events the kernel/PMU does not expose are skipped;
+// on non-Linux platforms the collector is a no-op.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace disruptor::bench {
+
+enum class PerfEvent { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, DTLB_MISSES, BRANCH_MISSES, COUNT };
+
+constexpr std::size_t kPerfEventCount = static_cast<std::size_t>(PerfEvent::COUNT);
+
+inline const char *perfEventName(std::size_t index) {
+  static constexpr const char *names[kPerfEventCount] = {"cycles",      "instructions", "l1d_misses",
+                                                         "llc_misses",  "dtlb_misses",  "branch_misses"};
+  return names[index];
+}
+
+inline bool &perfCountersEnabled() {
+  static bool enabled = false;
+  return enabled;
+}
+
+// Removes --disruptor_perf_counters from argv (Google Benchmark rejects unknown
+// flags) and enables collection if it was present.
+inline void parsePerfCounterFlag(int &argc, char **argv) {
+  int out = 1;
+  for (int i = 1; i < argc; ++i) {
+    if (std::string(argv[i]) == "--disruptor_perf_counters") {
+      perfCountersEnabled() = true;
+    } else {
+      argv[out++] = argv[i];
+    }
+  }
+  argc = out;
+}
+
+#if defined(__linux__)
+using ThreadId = pid_t;
+
+inline ThreadId currentThreadId() { return static_cast<ThreadId>(::syscall(SYS_gettid)); }
+#else
+using ThreadId = int;
+
+inline ThreadId currentThreadId() { return 0; }
+#endif
+
+// One counter per event for a single thread (tid 0 == calling thread).
+// Counters are opened individually rather than as a group so that a PMU
+// without, say, dTLB events still reports the rest; values are scaled by
+// time_enabled / time_running when the kernel multiplexes them.
+class ThreadPerfCounters {
+public:
+  using Values = std::array<double, kPerfEventCount>;
+
+  explicit ThreadPerfCounters(ThreadId tid = 0) {
+    fds_.fill(-1);
+#if defined(__linux__)
+    for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      configure(static_cast<PerfEvent>(i), attr);
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fds_[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+    }
+#else
+    (void)tid;
+#endif
+  }
+
+  ~ThreadPerfCounters() {
+#if defined(__linux__)
+    for (int fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+#endif
+  }
+
+  ThreadPerfCounters(const ThreadPerfCounters &) = delete;
+  ThreadPerfCounters &operator=(const ThreadPerfCounters &) = delete;
+
+  bool isOpen(std::size_t index) const { return fds_[index] >= 0; }
+
+  bool anyOpen() const {
+    for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+      if (isOpen(i)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void start() {
+#if defined(__linux__)
+    for (int fd : fds_) {
+      if (fd >= 0) {
+        ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  void stop() {
+#if defined(__linux__)
+    for (int fd : fds_) {
+      if (fd >= 0) {
+        ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+#endif
+  }
+
+  Values read() const {
+    Values values{};
+#if defined(__linux__)
+    for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+      struct {
+        uint64_t value;
+        uint64_t timeEnabled;
+        uint64_t timeRunning;
+      } sample{};
+      if (fds_[i] < 0 || ::read(fds_[i], &sample, sizeof(sample)) != static_cast<ssize_t>(sizeof(sample))) {
+        continue;
+      }
+      values[i] = sample.timeRunning == 0
+                      ? 0.0
+                      : static_cast<double>(sample.value) * static_cast<double>(sample.timeEnabled) /
+                            static_cast<double>(sample.timeRunning);
+    }
+#endif
+    return values;
+  }
+
+private:
+#if defined(__linux__)
+  static void configure(PerfEvent event, perf_event_attr &attr) {
+    auto cache = [&attr](uint64_t cacheId) {
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = cacheId | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+    switch (event) {
+    case PerfEvent::CYCLES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case PerfEvent::INSTRUCTIONS:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case PerfEvent::L1D_MISSES:
+      cache(PERF_COUNT_HW_CACHE_L1D);
+      break;
+    case PerfEvent::LLC_MISSES:
+      cache(PERF_COUNT_HW_CACHE_LL);
+      break;
+    case PerfEvent::DTLB_MISSES:
+      cache(PERF_COUNT_HW_CACHE_DTLB);
+      break;
+    case PerfEvent::BRANCH_MISSES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case PerfEvent::COUNT:
+      break;
+    }
+  }
+#endif
+
+  std::array<int, kPerfEventCount> fds_;
+};
+
+// Consumer threads register here (from EventHandler::onStart or at the top of
+// a hand-rolled consumer loop) so the benchmark thread can count them too.
+class ConsumerThreadRegistry {
+public:
+  static ConsumerThreadRegistry &instance() {
+    static ConsumerThreadRegistry registry;
+    return registry;
+  }
+
+  void add(ThreadId tid) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.push_back(tid);
+  }
+
+  void remove(ThreadId tid) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = threads_.begin(); it != threads_.end(); ++it) {
+      if (*it == tid) {
+        threads_.erase(it);
+        return;
+      }
+    }
+  }
+
+  std::vector<ThreadId> snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return threads_;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::vector<ThreadId> threads_;
+};
+
+class ConsumerThreadRegistration {
+public:
+  ConsumerThreadRegistration() : tid_(currentThreadId()) { ConsumerThreadRegistry::instance().add(tid_); }
+  ~ConsumerThreadRegistration() { ConsumerThreadRegistry::instance().remove(tid_); }
+
+  ConsumerThreadRegistration(const ConsumerThreadRegistration &) = delete;
+  ConsumerThreadRegistration &operator=(const ConsumerThreadRegistration &) = delete;
+
+private:
+  ThreadId tid_;
+};
+
+class PerfCounterCollector {
+public:
+  // consumerThreads: how many registered consumer threads to wait for (up to
+  // one second) before counting starts. Only benchmark thread 0 counts them.
+  PerfCounterCollector(benchmark::State &state, std::size_t consumerThreads = 0) : state_(state) {
+    if (!perfCountersEnabled()) {
+      return;
+    }
+    producer_ = std::make_unique<ThreadPerfCounters>();
+    if (state_.thread_index() == 0 && consumerThreads > 0) {
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+      auto tids = ConsumerThreadRegistry::instance().snapshot();
+      while (tids.size() < consumerThreads && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+        tids = ConsumerThreadRegistry::instance().snapshot();
+      }
+      for (ThreadId tid : tids) {
+        consumers_.push_back(std::make_unique<ThreadPerfCounters>(tid));
+      }
+    }
+    if (!producer_->anyOpen()) {
+      warnUnavailable();
+    }
+    producer_->start();
+    for (auto &consumer : consumers_) {
+      consumer->start();
+    }
+  }
+
+  ~PerfCounterCollector() { stop(); }
+
+  PerfCounterCollector(const PerfCounterCollector &) = delete;
+  PerfCounterCollector &operator=(const PerfCounterCollector &) = delete;
+
+  // Call after the timed loop; adds the per-operation counters to state.
+  void report() {
+    if (!producer_) {
+      return;
+    }
+    stop();
+
+    const double ops = static_cast<double>(state_.iterations());
+    if (ops <= 0) {
+      return;
+    }
+
+    // Producer counters are per benchmark thread: average across threads.
+    const auto producerValues = producer_->read();
+    for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+      if (producer_->isOpen(i)) {
+        state_.counters[std::string("producer_") + perfEventName(i) + "_per_op"] =
+            benchmark::Counter(producerValues[i] / ops, benchmark::Counter::kAvgThreads);
+      }
+    }
+
+    // Consumer counters are reported once (thread 0) against the ops of all
+    // producer threads, so they are summed rather than averaged.
+    if (consumers_.empty()) {
+      return;
+    }
+    const double totalOps = ops * static_cast<double>(state_.threads());
+    ThreadPerfCounters::Values consumerTotals{};
+    std::array<bool, kPerfEventCount> open{};
+    for (const auto &consumer : consumers_) {
+      const auto values = consumer->read();
+      for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+        if (consumer->isOpen(i)) {
+          consumerTotals[i] += values[i];
+          open[i] = true;
+        }
+      }
+    }
+    for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+      if (open[i]) {
+        state_.counters[std::string("consumer_") + perfEventName(i) + "_per_op"] =
+            benchmark::Counter(consumerTotals[i] / totalOps);
+      }
+    }
+  }
+
+private:
+  void stop() {
+    if (stopped_ || !producer_) {
+      return;
+    }
+    stopped_ = true;
+    producer_->stop();
+    for (auto &consumer : consumers_) {
+      consumer->stop();
+    }
+  }
+
+  static void warnUnavailable() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+      std::fprintf(stderr, "*** Warning ***: perf_event_open failed; hardware counters unavailable "
+                           "(check /proc/sys/kernel/perf_event_paranoid)\n");
+    });
+  }
+
+  benchmark::State &state_;
+  std::unique_ptr<ThreadPerfCounters> producer_;
+  std::vector<std::unique_ptr<ThreadPerfCounters>> consumers_;
+  bool stopped_{false};
+};
+
+} // namespace disruptor::bench
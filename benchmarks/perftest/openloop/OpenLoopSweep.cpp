@@ -0,0 +1,208 @@
+// Open-loop latency sweep.
+//
+// One publisher sends into a dsl::Disruptor on a fixed-rate schedule that does
+// not slow down when the consumer falls behind, and the consumer measures
+// latency from the intended send time (see OpenLoopLoadGenerator.h). Each wait
+// strategy and ring size is swept across a range of offered rates:
+//
+//   PerfTest_OpenLoop/<WaitStrategy>/ring:<size>/rate:<events per second>
+//
+// Counters per point:
+//   p50_ns .. max_ns     corrected latency (consume - intended send)
+//   uncorrected_p99_ns   consume - actual send, what a closed-loop test reports
+//   achieved_rate        events per second the publisher actually sustained
+//   max_send_lag_ns      how far behind schedule the publisher fell
+//
+// After the last rate of a (wait strategy, ring) pair the saturation knee is
+// printed: the highest offered rate that was sustained (achieved >= 95% of
+// target) with corrected p99 within kKneeLatencyFactor of the lowest-rate p99.
+// Rates above the first unsustained one are skipped.
+//
+// Setting DISRUPTOR_OPENLOOP_TRACE=<file> (one inter-arrival gap in ns per
+// line) additionally replays that trace at 1x, 2x, 4x and 8x speed:
+//
+//   PerfTest_OpenLoopTrace/<WaitStrategy>/ring:<size>/speedup:<n>
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include "perftest/support/LatencyTestSupport.h"
+#include "perftest/support/OpenLoopLoadGenerator.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kRingSizes[] = {1024, 64 * 1024};
+constexpr double kRates[] = {100e3, 500e3, 1e6, 2e6, 5e6, 10e6};
+constexpr double kSecondsPerPoint = 0.5;
+constexpr int64_t kMaxEventsPerPoint = 5L * 1000L * 1000L;
+constexpr double kSustainedFraction = 0.95;
+constexpr double kKneeLatencyFactor = 10.0;
+constexpr double kTraceSpeedups[] = {1, 2, 4, 8};
+
+using disruptor::bench::perftest::support::ArrivalSchedule;
+using disruptor::bench::perftest::support::OpenLoopEvent;
+using disruptor::bench::perftest::support::OpenLoopLatencyHandler;
+using disruptor::bench::perftest::support::OpenLoopResult;
+
+struct SweepPoint {
+  double targetRate;
+  double achievedRate;
+  int64_t correctedP99;
+};
+
+// Results per "<WaitStrategy>/ring:<size>", in the order the rates ran.
+std::mutex g_sweepMutex;
+std::map<std::string, std::vector<SweepPoint>> g_sweepResults;
+
+void printKnee(const std::string &key, const std::vector<SweepPoint> &points) {
+  if (points.empty()) {
+    return;
+  }
+  const int64_t baselineP99 = std::max<int64_t>(points.front().correctedP99, 1);
+  const SweepPoint *knee = nullptr;
+  for (const auto &point : points) {
+    const bool sustained = point.achievedRate >= kSustainedFraction * point.targetRate;
+    const bool bounded = static_cast<double>(point.correctedP99) <= kKneeLatencyFactor * baselineP99;
+    if (!sustained || !bounded) {
+      break;
+    }
+    knee = &point;
+  }
+  if (knee == nullptr) {
+    std::printf("PerfTest_OpenLoop/%s saturation knee: below %.0f events/s\n", key.c_str(),
+                points.front().targetRate);
+  } else {
+    std::printf("PerfTest_OpenLoop/%s saturation knee: %.0f events/s (corrected p99=%lldns)\n", key.c_str(),
+                knee->targetRate, static_cast<long long>(knee->correctedP99));
+  }
+}
+
+template <typename WS>
+OpenLoopResult runOpenLoopPass(int ringSize, const ArrivalSchedule &schedule, OpenLoopLatencyHandler &handler) {
+  auto ws = disruptor::bench::perftest::support::newWaitStrategy<WS>();
+  disruptor::dsl::Disruptor<OpenLoopEvent, disruptor::dsl::ProducerType::SINGLE, WS> disruptor(
+      OpenLoopEvent::EVENT_FACTORY, ringSize, disruptor::util::DaemonThreadFactory::INSTANCE(), *ws);
+  disruptor.handleEventsWith(handler);
+  auto ringBuffer = disruptor.start();
+
+  const OpenLoopResult result = disruptor::bench::perftest::support::runOpenLoop(*ringBuffer, schedule);
+
+  disruptor.shutdown();
+  return result;
+}
+
+void reportOpenLoop(benchmark::State &state, const std::string &name, const OpenLoopResult &result,
+                    const OpenLoopLatencyHandler &handler) {
+  disruptor::bench::perftest::support::reportLatency(state, name.c_str(), handler.getCorrected());
+  state.counters["uncorrected_p99_ns"] =
+      benchmark::Counter(static_cast<double>(handler.getUncorrected().getValueAtPercentile(99.0)));
+  state.counters["target_rate"] = benchmark::Counter(result.targetRate);
+  state.counters["achieved_rate"] = benchmark::Counter(result.achievedRate);
+  state.counters["max_send_lag_ns"] = benchmark::Counter(static_cast<double>(result.maxSendLagNanos));
+}
+
+template <typename WS>
+void PerfTest_OpenLoop(benchmark::State &state, const std::string &name, const std::string &key, int ringSize,
+                       double rate) {
+  const bool lastRate = rate == std::end(kRates)[-1];
+  std::unique_lock<std::mutex> lock(g_sweepMutex);
+  auto &points = g_sweepResults[key];
+
+  // Past saturation the backlog (and so the run time) grows with the offered
+  // rate without telling us anything new, so the rest of the sweep is skipped.
+  if (!points.empty() && points.back().achievedRate < kSustainedFraction * points.back().targetRate) {
+    state.SkipWithError("skipped: publisher already saturated at a lower rate");
+    if (lastRate) {
+      printKnee(key, points);
+      points.clear();
+    }
+    return;
+  }
+  lock.unlock();
+
+  const auto events = std::min<int64_t>(static_cast<int64_t>(rate * kSecondsPerPoint), kMaxEventsPerPoint);
+  const ArrivalSchedule schedule = ArrivalSchedule::fixedRate(rate, events);
+
+  OpenLoopLatencyHandler handler;
+  OpenLoopResult result;
+  for (auto _ : state) {
+    result = runOpenLoopPass<WS>(ringSize, schedule, handler);
+  }
+  reportOpenLoop(state, name, result, handler);
+
+  lock.lock();
+  points.push_back({rate, result.achievedRate, handler.getCorrected().getValueAtPercentile(99.0)});
+  if (lastRate) {
+    printKnee(key, points);
+    points.clear();
+  }
+}
+
+template <typename WS>
+void PerfTest_OpenLoopTrace(benchmark::State &state, const std::string &name, int ringSize,
+                            const std::vector<int64_t> &trace, double speedup) {
+  const ArrivalSchedule schedule =
+      ArrivalSchedule::trace(trace, speedup, std::min<int64_t>(static_cast<int64_t>(trace.size()), kMaxEventsPerPoint));
+
+  OpenLoopLatencyHandler handler;
+  OpenLoopResult result;
+  for (auto _ : state) {
+    result = runOpenLoopPass<WS>(ringSize, schedule, handler);
+  }
+  reportOpenLoop(state, name, result, handler);
+}
+
+const int registered = [] {
+  const char *tracePath = std::getenv("DISRUPTOR_OPENLOOP_TRACE");
+  auto trace = std::make_shared<std::vector<int64_t>>();
+  if (tracePath != nullptr) {
+    *trace = disruptor::bench::perftest::support::loadInterArrivalTrace(tracePath);
+  }
+
+  disruptor::bench::perftest::support::forEachWaitStrategy([&trace](auto type, const char *wsName) {
+    using WS = typename decltype(type)::type;
+    for (int ringSize : kRingSizes) {
+      const std::string key = std::string(wsName) + "/ring:" + std::to_string(ringSize);
+      for (double rate : kRates) {
+        const std::string name =
+            "PerfTest_OpenLoop/" + key + "/rate:" + std::to_string(static_cast<int64_t>(rate));
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     [name, key, ringSize, rate](benchmark::State &state) {
+                                       PerfTest_OpenLoop<WS>(state, name, key, ringSize, rate);
+                                     })
+            ->Unit(benchmark::kMillisecond)
+            ->Iterations(1)
+            ->UseRealTime();
+      }
+      if (trace->empty()) {
+        continue;
+      }
+      for (double speedup : kTraceSpeedups) {
+        const std::string name =
+            "PerfTest_OpenLoopTrace/" + key + "/speedup:" + std::to_string(static_cast<int>(speedup));
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     [name, ringSize, trace, speedup](benchmark::State &state) {
+                                       PerfTest_OpenLoopTrace<WS>(state, name, ringSize, *trace, speedup);
+                                     })
+            ->Unit(benchmark::kMillisecond)
+            ->Iterations(1)
+            ->UseRealTime();
+      }
+    }
+  });
+  return 0;
+}();
+
+} // namespace
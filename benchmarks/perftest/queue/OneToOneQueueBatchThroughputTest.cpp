@@ -0,0 +1,64 @@
+// Queue baseline for OneToOneSequencedBatchThroughputTest: the publisher puts
+// BATCH_SIZE values per lock acquisition (the closest a std::mutex +
+// std::deque queue gets to claiming a range of ring buffer slots).
+//
+//        putAll   take
+// +----+    +====+    +-----+
+// | P1 |--->| Q1 |<---| EP1 |
+// +----+    +====+    +-----+
+//
+// P1  - Publisher 1
+// Q1  - Queue 1
+// EP1 - EventProcessor 1
+
+#include <benchmark/benchmark.h>
+
+#include "perftest/support/AbstractPerfTestQueue.h"
+#include "perftest/support/BlockingQueue.h"
+#include "perftest/support/PerfTestUtil.h"
+#include "perftest/support/QueueProcessors.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr int kBatchSize = 10;
+constexpr int kBufferSize = 1024 * 64;
+constexpr int64_t kIterations = 1000L * 1000L * 10L;
+
+class OneToOneQueueBatchThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestQueue {
+public:
+  int getRequiredProcessorCount() const override { return 2; }
+
+  int64_t runQueuePass() override {
+    queueProcessor_.reset();
+    std::thread processorThread([this] { queueProcessor_.run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    std::array<int64_t, kBatchSize> batch{};
+    for (int64_t i = 0; i < kIterations; i++) {
+      batch.fill(i);
+      blockingQueue_.putAll(batch.begin(), batch.end());
+    }
+    processorThread.join();
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    disruptor::bench::perftest::support::failIfNot(expectedResult_, queueProcessor_.getValue());
+    return (kBatchSize * kIterations * 1000L) / elapsedMs;
+  }
+
+private:
+  const int64_t expectedResult_ = disruptor::bench::perftest::support::accumulatedAddition(kIterations) * kBatchSize;
+  disruptor::bench::perftest::support::BlockingQueue<int64_t> blockingQueue_{kBufferSize};
+  disruptor::bench::perftest::support::ValueAdditionQueueProcessor queueProcessor_{blockingQueue_,
+                                                                                   kIterations * kBatchSize};
+};
+
+const auto *registered = disruptor::bench::perftest::registerQueuePerfTest<OneToOneQueueBatchThroughputTest>(
+    "PerfTest_OneToOneQueueBatchThroughputTest");
+
+} // namespace
@@ -0,0 +1,98 @@
+// 1:1 port of com.lmax.disruptor.queue.OneToThreeDiamondQueueThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/queue/OneToThreeDiamondQueueThroughputTest.java
+//
+// Produce an event replicated to two event processors and fold back to a single third event processor.
+//
+// Queue Based:
+// ============
+//                 take       put
+//    put    +====+    +-----+    +====+  take
+//    +----->| Q1 |<---| EP1 |--->| Q3 |<------+
+//    |      +====+    +-----+    +====+       |
+//    |                                        |
+// +----+    +====+    +-----+    +====+    +-----+
+// | P1 |--->| Q2 |<---| EP2 |--->| Q4 |<---| EP3 |
+// +----+    +====+    +-----+    +====+    +-----+
+//      put      take       put      take
+//
+// P1  - Publisher 1
+// Q1  - Queue 1
+// Q2  - Queue 2
+// Q3  - Queue 3
+// Q4  - Queue 4
+// EP1 - EventProcessor 1
+// EP2 - EventProcessor 2
+// EP3 - EventProcessor 3
+
+#include <benchmark/benchmark.h>
+
+#include "perftest/support/AbstractPerfTestQueue.h"
+#include "perftest/support/BlockingQueue.h"
+#include "perftest/support/PerfTestUtil.h"
+#include "perftest/support/QueueProcessors.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr int kBufferSize = 1024 * 8;
+constexpr int64_t kIterations = 1000L * 1000L * 10L;
+
+using disruptor::bench::perftest::support::BlockingQueue;
+using disruptor::bench::perftest::support::FizzBuzzQueueProcessor;
+
+class OneToThreeDiamondQueueThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestQueue {
+public:
+  OneToThreeDiamondQueueThroughputTest() {
+    for (int64_t i = 0; i < kIterations; i++) {
+      const bool fizz = 0 == (i % 3L);
+      const bool buzz = 0 == (i % 5L);
+      if (fizz && buzz) {
+        ++expectedResult_;
+      }
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  int64_t runQueuePass() override {
+    fizzBuzzQueueProcessor_.reset();
+    std::thread fizz([this] { fizzQueueProcessor_.run(); });
+    std::thread buzz([this] { buzzQueueProcessor_.run(); });
+    std::thread fizzBuzz([this] { fizzBuzzQueueProcessor_.run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < kIterations; i++) {
+      fizzInputQueue_.put(i);
+      buzzInputQueue_.put(i);
+    }
+    fizz.join();
+    buzz.join();
+    fizzBuzz.join();
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    disruptor::bench::perftest::support::failIfNot(expectedResult_, fizzBuzzQueueProcessor_.getFizzBuzzCounter());
+    return (kIterations * 1000L) / elapsedMs;
+  }
+
+private:
+  int64_t expectedResult_{0};
+  BlockingQueue<int64_t> fizzInputQueue_{kBufferSize};
+  BlockingQueue<int64_t> buzzInputQueue_{kBufferSize};
+  BlockingQueue<bool> fizzOutputQueue_{kBufferSize};
+  BlockingQueue<bool> buzzOutputQueue_{kBufferSize};
+  FizzBuzzQueueProcessor fizzQueueProcessor_{FizzBuzzQueueProcessor::Step::FIZZ, fizzInputQueue_, buzzInputQueue_,
+                                             fizzOutputQueue_, buzzOutputQueue_, kIterations};
+  FizzBuzzQueueProcessor buzzQueueProcessor_{FizzBuzzQueueProcessor::Step::BUZZ, fizzInputQueue_, buzzInputQueue_,
+                                             fizzOutputQueue_, buzzOutputQueue_, kIterations};
+  FizzBuzzQueueProcessor fizzBuzzQueueProcessor_{FizzBuzzQueueProcessor::Step::FIZZ_BUZZ, fizzInputQueue_,
+                                                 buzzInputQueue_, fizzOutputQueue_, buzzOutputQueue_, kIterations};
+};
+
+const auto *registered = disruptor::bench::perftest::registerQueuePerfTest<OneToThreeDiamondQueueThroughputTest>(
+    "PerfTest_OneToThreeDiamondQueueThroughputTest");
+
+} // namespace
@@ -0,0 +1,96 @@
+// 1:1 port of com.lmax.disruptor.queue.OneToThreePipelineQueueThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/queue/OneToThreePipelineQueueThroughputTest.java
+//
+// Pipeline a series of stages from a publisher to ultimate event processor.
+// Each event processor depends on the output of the event processor.
+//
+// Queue Based:
+// ============
+//
+//        put      take        put      take        put      take
+// +----+    +====+    +-----+    +====+    +-----+    +====+    +-----+
+// | P1 |--->| Q1 |<---| EP1 |--->| Q2 |<---| EP2 |--->| Q3 |<---| EP3 |
+// +----+    +====+    +-----+    +====+    +-----+    +====+    +-----+
+//
+// P1  - Publisher 1
+// Q1  - Queue 1
+// EP1 - EventProcessor 1
+// Q2  - Queue 2
+// EP2 - EventProcessor 2
+// Q3  - Queue 3
+// EP3 - EventProcessor 3
+
+#include <benchmark/benchmark.h>
+
+#include "perftest/support/AbstractPerfTestQueue.h"
+#include "perftest/support/BlockingQueue.h"
+#include "perftest/support/PerfTestUtil.h"
+#include "perftest/support/QueueProcessors.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr int kBufferSize = 1024 * 8;
+constexpr int64_t kIterations = 1000L * 1000L * 10L;
+constexpr int64_t kOperandTwoInitialValue = 777L;
+
+using disruptor::bench::perftest::support::BlockingQueue;
+using disruptor::bench::perftest::support::FunctionQueueProcessor;
+
+class OneToThreePipelineQueueThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestQueue {
+public:
+  OneToThreePipelineQueueThroughputTest() {
+    int64_t operandTwo = kOperandTwoInitialValue;
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t stepOneResult = i + operandTwo--;
+      const int64_t stepTwoResult = stepOneResult + 3;
+      if ((stepTwoResult & 4L) == 4L) {
+        ++expectedResult_;
+      }
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  int64_t runQueuePass() override {
+    stepThreeQueueProcessor_.reset();
+    std::thread stepOne([this] { stepOneQueueProcessor_.run(); });
+    std::thread stepTwo([this] { stepTwoQueueProcessor_.run(); });
+    std::thread stepThree([this] { stepThreeQueueProcessor_.run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    int64_t operandTwo = kOperandTwoInitialValue;
+    for (int64_t i = 0; i < kIterations; i++) {
+      stepOneQueue_.put({i, operandTwo--});
+    }
+    stepOne.join();
+    stepTwo.join();
+    stepThree.join();
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    disruptor::bench::perftest::support::failIfNot(expectedResult_, stepThreeQueueProcessor_.getStepThreeCounter());
+    return (kIterations * 1000L) / elapsedMs;
+  }
+
+private:
+  int64_t expectedResult_{0};
+  BlockingQueue<std::array<int64_t, 2>> stepOneQueue_{kBufferSize};
+  BlockingQueue<int64_t> stepTwoQueue_{kBufferSize};
+  BlockingQueue<int64_t> stepThreeQueue_{kBufferSize};
+  FunctionQueueProcessor stepOneQueueProcessor_{FunctionQueueProcessor::Step::ONE, stepOneQueue_, stepTwoQueue_,
+                                                stepThreeQueue_, kIterations};
+  FunctionQueueProcessor stepTwoQueueProcessor_{FunctionQueueProcessor::Step::TWO, stepOneQueue_, stepTwoQueue_,
+                                                stepThreeQueue_, kIterations};
+  FunctionQueueProcessor stepThreeQueueProcessor_{FunctionQueueProcessor::Step::THREE, stepOneQueue_, stepTwoQueue_,
+                                                  stepThreeQueue_, kIterations};
+};
+
+const auto *registered = disruptor::bench::perftest::registerQueuePerfTest<OneToThreePipelineQueueThroughputTest>(
+    "PerfTest_OneToThreePipelineQueueThroughputTest");
+
+} // namespace
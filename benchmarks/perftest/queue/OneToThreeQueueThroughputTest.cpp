@@ -0,0 +1,102 @@
+// 1:1 port of com.lmax.disruptor.queue.OneToThreeQueueThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/queue/OneToThreeQueueThroughputTest.java
+//
+// MultiCast a series of items between 1 publisher and 3 event processors.
+//
+// Queue Based:
+// ============
+//                 take
+//   put     +====+    +-----+
+//    +----->| Q1 |<---| EP1 |
+//    |      +====+    +-----+
+//    |
+// +----+    +====+    +-----+
+// | P1 |--->| Q2 |<---| EP2 |
+// +----+    +====+    +-----+
+//    |
+//    |      +====+    +-----+
+//    +----->| Q3 |<---| EP3 |
+//           +====+    +-----+
+//
+// P1  - Publisher 1
+// Q1  - Queue 1
+// Q2  - Queue 2
+// Q3  - Queue 3
+// EP1 - EventProcessor 1
+// EP2 - EventProcessor 2
+// EP3 - EventProcessor 3
+
+#include <benchmark/benchmark.h>
+
+#include "perftest/support/AbstractPerfTestQueue.h"
+#include "perftest/support/BlockingQueue.h"
+#include "perftest/support/Operation.h"
+#include "perftest/support/PerfTestUtil.h"
+#include "perftest/support/QueueProcessors.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr int kNumEventProcessors = 3;
+constexpr int kBufferSize = 1024 * 8;
+constexpr int64_t kIterations = 1000L * 1000L * 10L;
+
+using disruptor::bench::perftest::support::BlockingQueue;
+using disruptor::bench::perftest::support::Operation;
+using disruptor::bench::perftest::support::ValueMutationQueueProcessor;
+
+class OneToThreeQueueThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestQueue {
+public:
+  OneToThreeQueueThroughputTest() {
+    for (int64_t i = 0; i < kIterations; i++) {
+      results_[0] = op(Operation::ADDITION, results_[0], i);
+      results_[1] = op(Operation::SUBTRACTION, results_[1], i);
+      results_[2] = op(Operation::AND, results_[2], i);
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  int64_t runQueuePass() override {
+    std::array<std::thread, kNumEventProcessors> threads;
+    for (int i = 0; i < kNumEventProcessors; i++) {
+      queueProcessors_[i].reset();
+      threads[i] = std::thread([this, i] { queueProcessors_[i].run(); });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < kIterations; i++) {
+      blockingQueues_[0].put(i);
+      blockingQueues_[1].put(i);
+      blockingQueues_[2].put(i);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    for (int i = 0; i < kNumEventProcessors; i++) {
+      disruptor::bench::perftest::support::failIfNot(results_[i], queueProcessors_[i].getValue());
+    }
+    return (kIterations * 1000L) / elapsedMs;
+  }
+
+private:
+  std::array<int64_t, kNumEventProcessors> results_{};
+  std::array<BlockingQueue<int64_t>, kNumEventProcessors> blockingQueues_{
+      BlockingQueue<int64_t>(kBufferSize), BlockingQueue<int64_t>(kBufferSize), BlockingQueue<int64_t>(kBufferSize)};
+  std::array<ValueMutationQueueProcessor, kNumEventProcessors> queueProcessors_{
+      ValueMutationQueueProcessor(blockingQueues_[0], Operation::ADDITION, kIterations),
+      ValueMutationQueueProcessor(blockingQueues_[1], Operation::SUBTRACTION, kIterations),
+      ValueMutationQueueProcessor(blockingQueues_[2], Operation::AND, kIterations)};
+};
+
+const auto *registered = disruptor::bench::perftest::registerQueuePerfTest<OneToThreeQueueThroughputTest>(
+    "PerfTest_OneToThreeQueueThroughputTest");
+
+} // namespace
@@ -0,0 +1,80 @@
+// Queue baseline for ThreeToOneSequencedBatchThroughputTest: each publisher
+// puts BATCH_SIZE values per lock acquisition.
+//
+// +----+  putAll
+// | P1 |------+
+// +----+      |
+//             v   take
+// +----+    +====+    +-----+
+// | P2 |--->| Q1 |<---| EP1 |
+// +----+    +====+    +-----+
+//             ^
+// +----+      |
+// | P3 |------+
+// +----+  putAll
+//
+// P1  - Publisher 1
+// P2  - Publisher 2
+// P3  - Publisher 3
+// Q1  - Queue 1
+// EP1 - EventProcessor 1
+
+#include <benchmark/benchmark.h>
+
+#include "perftest/support/AbstractPerfTestQueue.h"
+#include "perftest/support/BlockingQueue.h"
+#include "perftest/support/QueueProcessors.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr int kNumPublishers = 3;
+constexpr int kBatchSize = 10;
+constexpr int kBufferSize = 1024 * 64;
+constexpr int64_t kIterations = 1000L * 1000L * 20L;
+// Each publisher publishes whole batches only.
+constexpr int64_t kIterationsPerPublisher = (kIterations / kNumPublishers / kBatchSize) * kBatchSize;
+
+using disruptor::bench::perftest::support::ValueQueuePublisher;
+
+class ThreeToOneQueueBatchThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestQueue {
+public:
+  int getRequiredProcessorCount() const override { return 4; }
+
+  int64_t runQueuePass() override {
+    queueProcessor_.reset();
+    std::atomic<bool> startSignal{false};
+    std::array<std::thread, kNumPublishers> publishers;
+    for (auto &publisher : publishers) {
+      publisher = std::thread([this, &startSignal] {
+        ValueQueuePublisher(startSignal, blockingQueue_, kIterationsPerPublisher, kBatchSize).run();
+      });
+    }
+    std::thread processorThread([this] { queueProcessor_.run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    startSignal.store(true, std::memory_order_release);
+    processorThread.join();
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    for (auto &publisher : publishers) {
+      publisher.join();
+    }
+    return (kIterationsPerPublisher * kNumPublishers * 1000L) / elapsedMs;
+  }
+
+private:
+  disruptor::bench::perftest::support::BlockingQueue<int64_t> blockingQueue_{kBufferSize};
+  disruptor::bench::perftest::support::ValueAdditionQueueProcessor queueProcessor_{
+      blockingQueue_, kIterationsPerPublisher * kNumPublishers};
+};
+
+const auto *registered = disruptor::bench::perftest::registerQueuePerfTest<ThreeToOneQueueBatchThroughputTest>(
+    "PerfTest_ThreeToOneQueueBatchThroughputTest");
+
+} // namespace
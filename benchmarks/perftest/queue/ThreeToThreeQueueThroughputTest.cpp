@@ -0,0 +1,110 @@
+// Queue baseline for ThreeToThreeSequencedThroughputTest: three publishers,
+// each with its own queue of long[] arrays, drained in turn by one processor.
+//
+//        put      poll
+// +----+    +====+
+// | P1 |--->| Q1 |<--+
+// +----+    +====+   |
+//                    |
+// +----+    +====+   |  +----+
+// | P2 |--->| Q2 |<--+--| EP |
+// +----+    +====+   |  +----+
+//                    |
+// +----+    +====+   |
+// | P3 |--->| Q3 |<--+
+// +----+    +====+
+//
+// P1 - Publisher 1
+// P2 - Publisher 2
+// P3 - Publisher 3
+// Q1 - Queue 1
+// Q2 - Queue 2
+// Q3 - Queue 3
+// EP - EventProcessor
+
+#include <benchmark/benchmark.h>
+
+#include "perftest/support/AbstractPerfTestQueue.h"
+#include "perftest/support/BlockingQueue.h"
+#include "perftest/support/LongArrayEvent.h"
+#include "perftest/support/PerfTestUtil.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr int kNumPublishers = 3;
+constexpr int kBufferSize = 1024 * 64;
+constexpr int64_t kIterations = 1000L * 1000L * 18L;
+
+using disruptor::bench::perftest::support::BlockingQueue;
+using disruptor::bench::perftest::support::LongArrayEvent;
+
+class ThreeToThreeQueueThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestQueue {
+public:
+  int getRequiredProcessorCount() const override { return 4; }
+
+  int64_t runQueuePass() override {
+    std::atomic<bool> startSignal{false};
+    std::array<std::thread, kNumPublishers> publishers;
+    for (int i = 0; i < kNumPublishers; i++) {
+      publishers[i] = std::thread([this, i, &startSignal] {
+        disruptor::bench::perftest::support::awaitStart(startSignal);
+        LongArrayEvent event{};
+        for (int64_t value = 0; value < kIterations / kNumPublishers; value++) {
+          event.fill(value);
+          blockingQueues_[i].put(event);
+        }
+      });
+    }
+
+    int64_t result = 0;
+    std::thread processorThread([this, &result] {
+      int64_t remaining = (kIterations / kNumPublishers) * kNumPublishers;
+      LongArrayEvent event{};
+      while (remaining > 0) {
+        bool idle = true;
+        for (auto &queue : blockingQueues_) {
+          while (queue.poll(event)) {
+            for (const int64_t element : event) {
+              result += element;
+            }
+            --remaining;
+            idle = false;
+          }
+        }
+        if (idle) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    startSignal.store(true, std::memory_order_release);
+    processorThread.join();
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    for (auto &publisher : publishers) {
+      publisher.join();
+    }
+
+    const int64_t expected = disruptor::bench::perftest::support::accumulatedAddition(kIterations / kNumPublishers) *
+                             kNumPublishers * disruptor::bench::perftest::support::LONG_ARRAY_SIZE;
+    disruptor::bench::perftest::support::failIfNot(expected, result);
+    return (kIterations * 1000L) / elapsedMs;
+  }
+
+private:
+  std::array<BlockingQueue<LongArrayEvent>, kNumPublishers> blockingQueues_{
+      BlockingQueue<LongArrayEvent>(kBufferSize), BlockingQueue<LongArrayEvent>(kBufferSize),
+      BlockingQueue<LongArrayEvent>(kBufferSize)};
+};
+
+const auto *registered = disruptor::bench::perftest::registerQueuePerfTest<ThreeToThreeQueueThroughputTest>(
+    "PerfTest_ThreeToThreeQueueThroughputTest");
+
+} // namespace
@@ -0,0 +1,122 @@
+// 1:1 port of com.lmax.disruptor.sequenced.OneToOneSequencedBatchThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/sequenced/OneToOneSequencedBatchThroughputTest.java
+//
+// UniCast a series of items between 1 publisher and 1 event processor,
+// claiming and publishing BATCH_SIZE slots at a time.
+//
+// +----+    +-----+
+// | P1 |--->| EP1 |
+// +----+    +-----+
+//
+// Disruptor:
+// ==========
+//              track to prevent wrap
+//              +------------------+
+//              |                  |
+//              |                  v
+// +----+    +====+    +====+   +-----+
+// | P1 |--->| RB |<---| SB |   | EP1 |
+// +----+    +====+    +====+   +-----+
+//      claim      get    ^        |
+//                        |        |
+//                        +--------+
+//                          waitFor
+//
+// P1  - Publisher 1
+// RB  - RingBuffer
+// SB  - SequenceBarrier
+// EP1 - EventProcessor 1
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+
+#include "perftest/support/AbstractPerfTestDisruptor.h"
+#include "perftest/support/PerfTestUtil.h"
+#include "perftest/support/ValueAdditionEventHandler.h"
+#include "perftest/support/ValueEvent.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+
+constexpr int kBatchSize = 10;
+constexpr int kBufferSize = 1024 * 64;
+constexpr int64_t kIterations = 1000L * 1000L * 100L;
+
+class OneToOneSequencedBatchThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestDisruptor {
+public:
+  using PerfTestContext = disruptor::bench::perftest::PerfTestContext;
+  using ValueEvent = disruptor::bench::perftest::support::ValueEvent;
+  using ValueAdditionEventHandler = disruptor::bench::perftest::support::ValueAdditionEventHandler;
+  using WS = disruptor::YieldingWaitStrategy;
+  using RingBufferType = disruptor::RingBuffer<ValueEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<ValueEvent, BarrierType>;
+
+  OneToOneSequencedBatchThroughputTest()
+      : expectedResult_(disruptor::bench::perftest::support::accumulatedAddition(kIterations) * kBatchSize),
+        ringBuffer_(disruptor::SingleProducerRingBuffer<ValueEvent, WS>::createSingleProducer(
+            ValueEvent::EVENT_FACTORY, kBufferSize, ws_)),
+        sequenceBarrier_(ringBuffer_->newBarrier()),
+        batchEventProcessor_([this]() {
+          disruptor::BatchEventProcessorBuilder builder;
+          return builder.build(*ringBuffer_, *sequenceBarrier_, handler_);
+        }()) {
+    ringBuffer_->addGatingSequences(batchEventProcessor_->getSequence());
+  }
+
+  int getRequiredProcessorCount() const override { return 2; }
+
+  PerfTestContext runDisruptorPass() override {
+    PerfTestContext perfTestContext;
+    auto latch = std::make_shared<std::atomic<bool>>(false);
+    const int64_t expectedCount = batchEventProcessor_->getSequence().get() + kIterations * kBatchSize;
+    handler_.reset(latch, expectedCount);
+    std::thread processorThread([this] { batchEventProcessor_->run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t hi = ringBuffer_->next(kBatchSize);
+      const int64_t lo = hi - (kBatchSize - 1);
+      for (int64_t l = lo; l <= hi; l++) {
+        ringBuffer_->get(l).setValue(i);
+      }
+      ringBuffer_->publish(lo, hi);
+    }
+    while (!latch->load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    perfTestContext.setDisruptorOps((kBatchSize * kIterations * 1000L) / elapsedMs);
+    perfTestContext.setBatchData(handler_.getBatchesProcessed(), kIterations * kBatchSize);
+
+    batchEventProcessor_->halt();
+    processorThread.join();
+
+    disruptor::bench::perftest::support::failIfNot(expectedResult_, handler_.getValue());
+    return perfTestContext;
+  }
+
+private:
+  const int64_t expectedResult_;
+  WS ws_;
+  std::shared_ptr<RingBufferType> ringBuffer_;
+  std::shared_ptr<BarrierType> sequenceBarrier_;
+  ValueAdditionEventHandler handler_;
+  std::shared_ptr<BatchProcessorType> batchEventProcessor_;
+};
+
+const auto *registered = disruptor::bench::perftest::registerDisruptorPerfTest<OneToOneSequencedBatchThroughputTest>(
+    "PerfTest_OneToOneSequencedBatchThroughputTest");
+
+} // namespace
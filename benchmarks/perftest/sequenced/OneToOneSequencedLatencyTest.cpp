@@ -0,0 +1,162 @@
+// Port of the Disruptor 2.x/3.x OnePublisherToOneProcessorUniCastLatencyTest,
+// named to sit beside OneToOneSequencedThroughputTest.
+//
+// UniCast a series of items between 1 publisher and 1 event processor. The
+// publisher stamps System.nanoTime() into each event and pauses between
+// publishes; the event processor records (now - stamp) into a histogram.
+//
+// +----+    +-----+
+// | P1 |--->| EP1 |
+// +----+    +-----+
+//
+// Disruptor:
+// ==========
+//              track to prevent wrap
+//              +------------------+
+//              |                  |
+//              |                  v
+// +----+    +====+    +====+   +-----+
+// | P1 |--->| RB |<---| SB |   | EP1 |
+// +----+    +====+    +====+   +-----+
+//      claim      get    ^        |
+//                        |        |
+//                        +--------+
+//                          waitFor
+//
+// P1  - Publisher 1
+// RB  - RingBuffer
+// SB  - SequenceBarrier
+// EP1 - EventProcessor 1
+//
+// Runs once per wait strategy, unloaded and under background CPU load.
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/util/LatencyHistogram.h"
+#include "disruptor/util/Util.h"
+
+#include "perftest/support/LatencyTestSupport.h"
+#include "perftest/support/ValueEvent.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+constexpr int kBufferSize = 1024;
+constexpr int64_t kIterations = 1000L * 1000L;
+constexpr int64_t kPauseNanos = 1000L;
+constexpr int kRuns = 3;
+
+using disruptor::bench::perftest::support::LoadCondition;
+using disruptor::bench::perftest::support::ValueEvent;
+
+// Java: LatencyStepEventHandler(FunctionStep.ONE, histogram, nanoTimeCost, latch, expectedCount)
+class LatencyRecordingEventHandler final : public disruptor::EventHandler<ValueEvent> {
+public:
+  void reset(disruptor::util::LatencyHistogram &histogram, std::atomic<bool> &latch, int64_t expectedCount) {
+    histogram_ = &histogram;
+    latch_ = &latch;
+    count_ = expectedCount;
+  }
+
+  void onEvent(ValueEvent &event, int64_t sequence, bool /*endOfBatch*/) override {
+    histogram_->record(disruptor::util::Util::nanoTime() - event.getValue());
+    if (sequence == count_) {
+      latch_->store(true, std::memory_order_release);
+    }
+  }
+
+private:
+  disruptor::util::LatencyHistogram *histogram_{nullptr};
+  std::atomic<bool> *latch_{nullptr};
+  int64_t count_{0};
+};
+
+template <typename WS> class OneToOneSequencedLatencyTest {
+public:
+  using RingBufferType = disruptor::RingBuffer<ValueEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<ValueEvent, BarrierType>;
+
+  OneToOneSequencedLatencyTest()
+      : ws_(disruptor::bench::perftest::support::newWaitStrategy<WS>()),
+        ringBuffer_(disruptor::SingleProducerRingBuffer<ValueEvent, WS>::createSingleProducer(
+            ValueEvent::EVENT_FACTORY, kBufferSize, *ws_)),
+        sequenceBarrier_(ringBuffer_->newBarrier()),
+        batchEventProcessor_([this]() {
+          disruptor::BatchEventProcessorBuilder builder;
+          return builder.build(*ringBuffer_, *sequenceBarrier_, handler_);
+        }()) {
+    ringBuffer_->addGatingSequences(batchEventProcessor_->getSequence());
+  }
+
+  void runDisruptorPass(disruptor::util::LatencyHistogram &histogram) {
+    std::atomic<bool> latch{false};
+    const int64_t expectedCount = batchEventProcessor_->getSequence().get() + kIterations;
+    handler_.reset(histogram, latch, expectedCount);
+
+    std::thread processorThread([this] { batchEventProcessor_->run(); });
+
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t t0 = disruptor::util::Util::nanoTime();
+      const int64_t next = ringBuffer_->next();
+      ringBuffer_->get(next).setValue(t0);
+      ringBuffer_->publish(next);
+
+      disruptor::bench::perftest::support::busySpinFor(kPauseNanos);
+    }
+
+    while (!latch.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    batchEventProcessor_->halt();
+    processorThread.join();
+  }
+
+private:
+  std::unique_ptr<WS> ws_;
+  std::shared_ptr<RingBufferType> ringBuffer_;
+  std::shared_ptr<BarrierType> sequenceBarrier_;
+  LatencyRecordingEventHandler handler_;
+  std::shared_ptr<BatchProcessorType> batchEventProcessor_;
+};
+
+template <typename WS>
+void PerfTest_OneToOneSequencedLatencyTest(benchmark::State &state, const std::string &name,
+                                           LoadCondition condition) {
+  OneToOneSequencedLatencyTest<WS> test;
+  disruptor::util::LatencyHistogram histogram;
+  disruptor::bench::perftest::support::BackgroundLoad load(condition);
+
+  for (auto _ : state) {
+    test.runDisruptorPass(histogram);
+  }
+  disruptor::bench::perftest::support::reportLatency(state, name.c_str(), histogram);
+}
+
+const int registered = [] {
+  disruptor::bench::perftest::support::forEachWaitStrategy([](auto type, const char *wsName) {
+    using WS = typename decltype(type)::type;
+    for (auto condition : {LoadCondition::UNLOADED, LoadCondition::LOADED}) {
+      const std::string name = std::string("PerfTest_OneToOneSequencedLatencyTest/") + wsName + "/" +
+                               disruptor::bench::perftest::support::toString(condition);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   [name, condition](benchmark::State &state) {
+                                     PerfTest_OneToOneSequencedLatencyTest<WS>(state, name, condition);
+                                   })
+          ->Unit(benchmark::kMillisecond)
+          ->Iterations(kRuns)
+          ->UseRealTime();
+    }
+  });
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,160 @@
+// 1:1 port of com.lmax.disruptor.sequenced.OneToThreeDiamondSequencedThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/sequenced/OneToThreeDiamondSequencedThroughputTest.java
+//
+// Produce an event replicated to two event processors and fold back to a single third event processor.
+//
+//           +-----+
+//    +----->| EP1 |------+
+//    |      +-----+      |
+//    |                   v
+// +----+              +-----+
+// | P1 |              | EP3 |
+// +----+              +-----+
+//    |                   ^
+//    |      +-----+      |
+//    +----->| EP2 |------+
+//           +-----+
+//
+// Disruptor:
+// ==========
+//                    track to prevent wrap
+//              +-------------------------------+
+//              |                               |
+//              |                               v
+// +----+    +====+               +=====+    +-----+
+// | P1 |--->| RB |<--------------| SB2 |<---| EP3 |
+// +----+    +====+               +=====+    +-----+
+//      claim ^  get                 |   waitFor
+//            |                      |
+//         +=====+    +-----+        |
+//         | SB1 |<---| EP1 |<-------+
+//         +=====+    +-----+        |
+//            ^                      |
+//            |       +-----+        |
+//            +-------| EP2 |<-------+
+//           waitFor  +-----+
+//
+// P1  - Publisher 1
+// RB  - RingBuffer
+// SB1 - SequenceBarrier 1
+// EP1 - EventProcessor 1
+// EP2 - EventProcessor 2
+// SB2 - SequenceBarrier 2
+// EP3 - EventProcessor 3
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+
+#include "perftest/support/AbstractPerfTestDisruptor.h"
+#include "perftest/support/FizzBuzzEvent.h"
+#include "perftest/support/FizzBuzzEventHandler.h"
+#include "perftest/support/PerfTestUtil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+
+constexpr int kBufferSize = 1024 * 8;
+constexpr int64_t kIterations = 1000L * 1000L * 100L;
+
+using disruptor::bench::perftest::support::FizzBuzzStep;
+
+class OneToThreeDiamondSequencedThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestDisruptor {
+public:
+  using PerfTestContext = disruptor::bench::perftest::PerfTestContext;
+  using FizzBuzzEvent = disruptor::bench::perftest::support::FizzBuzzEvent;
+  using FizzBuzzEventHandler = disruptor::bench::perftest::support::FizzBuzzEventHandler;
+  using WS = disruptor::YieldingWaitStrategy;
+  using RingBufferType = disruptor::RingBuffer<FizzBuzzEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<FizzBuzzEvent, BarrierType>;
+
+  OneToThreeDiamondSequencedThroughputTest()
+      : ringBuffer_(disruptor::SingleProducerRingBuffer<FizzBuzzEvent, WS>::createSingleProducer(
+            FizzBuzzEvent::EVENT_FACTORY, kBufferSize, ws_)) {
+    disruptor::BatchEventProcessorBuilder builder;
+    sequenceBarrier_ = ringBuffer_->newBarrier();
+    batchProcessorFizz_ = builder.build(*ringBuffer_, *sequenceBarrier_, fizzHandler_);
+    batchProcessorBuzz_ = builder.build(*ringBuffer_, *sequenceBarrier_, buzzHandler_);
+
+    disruptor::Sequence *fizzBuzzDependencies[] = {&batchProcessorFizz_->getSequence(),
+                                                   &batchProcessorBuzz_->getSequence()};
+    sequenceBarrierFizzBuzz_ = ringBuffer_->newBarrier(fizzBuzzDependencies, 2);
+    batchProcessorFizzBuzz_ = builder.build(*ringBuffer_, *sequenceBarrierFizzBuzz_, fizzBuzzHandler_);
+
+    ringBuffer_->addGatingSequences(batchProcessorFizzBuzz_->getSequence());
+
+    for (int64_t i = 0; i < kIterations; i++) {
+      const bool fizz = 0 == (i % 3L);
+      const bool buzz = 0 == (i % 5L);
+      if (fizz && buzz) {
+        ++expectedResult_;
+      }
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  PerfTestContext runDisruptorPass() override {
+    PerfTestContext perfTestContext;
+    auto latch = std::make_shared<std::atomic<bool>>(false);
+    fizzBuzzHandler_.reset(latch, batchProcessorFizzBuzz_->getSequence().get() + kIterations);
+    fizzHandler_.reset(nullptr, -1);
+    buzzHandler_.reset(nullptr, -1);
+
+    std::thread fizz([this] { batchProcessorFizz_->run(); });
+    std::thread buzz([this] { batchProcessorBuzz_->run(); });
+    std::thread fizzBuzz([this] { batchProcessorFizzBuzz_->run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t sequence = ringBuffer_->next();
+      ringBuffer_->get(sequence).setValue(i);
+      ringBuffer_->publish(sequence);
+    }
+    while (!latch->load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    perfTestContext.setDisruptorOps((kIterations * 1000L) / elapsedMs);
+    perfTestContext.setBatchData(fizzBuzzHandler_.getBatchesProcessed(), kIterations);
+
+    batchProcessorFizz_->halt();
+    batchProcessorBuzz_->halt();
+    batchProcessorFizzBuzz_->halt();
+    fizz.join();
+    buzz.join();
+    fizzBuzz.join();
+
+    disruptor::bench::perftest::support::failIfNot(expectedResult_, fizzBuzzHandler_.getFizzBuzzCounter());
+    return perfTestContext;
+  }
+
+private:
+  int64_t expectedResult_{0};
+  WS ws_;
+  std::shared_ptr<RingBufferType> ringBuffer_;
+  FizzBuzzEventHandler fizzHandler_{FizzBuzzStep::FIZZ};
+  FizzBuzzEventHandler buzzHandler_{FizzBuzzStep::BUZZ};
+  FizzBuzzEventHandler fizzBuzzHandler_{FizzBuzzStep::FIZZ_BUZZ};
+  std::shared_ptr<BarrierType> sequenceBarrier_;
+  std::shared_ptr<BarrierType> sequenceBarrierFizzBuzz_;
+  std::shared_ptr<BatchProcessorType> batchProcessorFizz_;
+  std::shared_ptr<BatchProcessorType> batchProcessorBuzz_;
+  std::shared_ptr<BatchProcessorType> batchProcessorFizzBuzz_;
+};
+
+const auto *registered =
+    disruptor::bench::perftest::registerDisruptorPerfTest<OneToThreeDiamondSequencedThroughputTest>(
+        "PerfTest_OneToThreeDiamondSequencedThroughputTest");
+
+} // namespace
@@ -0,0 +1,157 @@
+// 1:1 port of com.lmax.disruptor.sequenced.OneToThreePipelineSequencedThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/sequenced/OneToThreePipelineSequencedThroughputTest.java
+//
+// Pipeline a series of stages from a publisher to ultimate event processor.
+// Each event processor depends on the output of the event processor.
+//
+// +----+    +-----+    +-----+    +-----+
+// | P1 |--->| EP1 |--->| EP2 |--->| EP3 |
+// +----+    +-----+    +-----+    +-----+
+//
+// Disruptor:
+// ==========
+//                           track to prevent wrap
+//              +----------------------------------------------------------------+
+//              |                                                                |
+//              |                                                                v
+// +----+    +====+    +=====+    +-----+    +=====+    +-----+    +=====+    +-----+
+// | P1 |--->| RB |    | SB1 |<---| EP1 |<---| SB2 |<---| EP2 |<---| SB3 |<---| EP3 |
+// +----+    +====+    +=====+    +-----+    +=====+    +-----+    +=====+    +-----+
+//      claim   ^  get    |   waitFor           |   waitFor           |  waitFor
+//              |         |                     |                     |
+//              +---------+---------------------+---------------------+
+//
+// P1  - Publisher 1
+// RB  - RingBuffer
+// SB1 - SequenceBarrier 1
+// EP1 - EventProcessor 1
+// SB2 - SequenceBarrier 2
+// EP2 - EventProcessor 2
+// SB3 - SequenceBarrier 3
+// EP3 - EventProcessor 3
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+
+#include "perftest/support/AbstractPerfTestDisruptor.h"
+#include "perftest/support/FunctionEvent.h"
+#include "perftest/support/FunctionEventHandler.h"
+#include "perftest/support/PerfTestUtil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+
+constexpr int kBufferSize = 1024 * 8;
+constexpr int64_t kIterations = 1000L * 1000L * 100L;
+constexpr int64_t kOperandTwoInitialValue = 777L;
+
+using disruptor::bench::perftest::support::FunctionStep;
+
+class OneToThreePipelineSequencedThroughputTest final
+    : public disruptor::bench::perftest::AbstractPerfTestDisruptor {
+public:
+  using PerfTestContext = disruptor::bench::perftest::PerfTestContext;
+  using FunctionEvent = disruptor::bench::perftest::support::FunctionEvent;
+  using FunctionEventHandler = disruptor::bench::perftest::support::FunctionEventHandler;
+  using WS = disruptor::YieldingWaitStrategy;
+  using RingBufferType = disruptor::RingBuffer<FunctionEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<FunctionEvent, BarrierType>;
+
+  OneToThreePipelineSequencedThroughputTest()
+      : ringBuffer_(disruptor::SingleProducerRingBuffer<FunctionEvent, WS>::createSingleProducer(
+            FunctionEvent::EVENT_FACTORY, kBufferSize, ws_)) {
+    disruptor::BatchEventProcessorBuilder builder;
+    stepOneSequenceBarrier_ = ringBuffer_->newBarrier();
+    stepOneBatchProcessor_ = builder.build(*ringBuffer_, *stepOneSequenceBarrier_, stepOneFunctionHandler_);
+
+    disruptor::Sequence *stepOneSequences[] = {&stepOneBatchProcessor_->getSequence()};
+    stepTwoSequenceBarrier_ = ringBuffer_->newBarrier(stepOneSequences, 1);
+    stepTwoBatchProcessor_ = builder.build(*ringBuffer_, *stepTwoSequenceBarrier_, stepTwoFunctionHandler_);
+
+    disruptor::Sequence *stepTwoSequences[] = {&stepTwoBatchProcessor_->getSequence()};
+    stepThreeSequenceBarrier_ = ringBuffer_->newBarrier(stepTwoSequences, 1);
+    stepThreeBatchProcessor_ = builder.build(*ringBuffer_, *stepThreeSequenceBarrier_, stepThreeFunctionHandler_);
+
+    ringBuffer_->addGatingSequences(stepThreeBatchProcessor_->getSequence());
+
+    int64_t operandTwo = kOperandTwoInitialValue;
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t stepOneResult = i + operandTwo--;
+      const int64_t stepTwoResult = stepOneResult + 3;
+      if ((stepTwoResult & 4L) == 4L) {
+        ++expectedResult_;
+      }
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  PerfTestContext runDisruptorPass() override {
+    PerfTestContext perfTestContext;
+    auto latch = std::make_shared<std::atomic<bool>>(false);
+    stepThreeFunctionHandler_.reset(latch, stepThreeBatchProcessor_->getSequence().get() + kIterations);
+    stepOneFunctionHandler_.reset(nullptr, -1);
+    stepTwoFunctionHandler_.reset(nullptr, -1);
+
+    std::thread stepOne([this] { stepOneBatchProcessor_->run(); });
+    std::thread stepTwo([this] { stepTwoBatchProcessor_->run(); });
+    std::thread stepThree([this] { stepThreeBatchProcessor_->run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    int64_t operandTwo = kOperandTwoInitialValue;
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t sequence = ringBuffer_->next();
+      FunctionEvent &event = ringBuffer_->get(sequence);
+      event.setOperandOne(i);
+      event.setOperandTwo(operandTwo--);
+      ringBuffer_->publish(sequence);
+    }
+    while (!latch->load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    perfTestContext.setDisruptorOps((kIterations * 1000L) / elapsedMs);
+    perfTestContext.setBatchData(stepThreeFunctionHandler_.getBatchesProcessed(), kIterations);
+
+    stepOneBatchProcessor_->halt();
+    stepTwoBatchProcessor_->halt();
+    stepThreeBatchProcessor_->halt();
+    stepOne.join();
+    stepTwo.join();
+    stepThree.join();
+
+    disruptor::bench::perftest::support::failIfNot(expectedResult_, stepThreeFunctionHandler_.getStepThreeCounter());
+    return perfTestContext;
+  }
+
+private:
+  int64_t expectedResult_{0};
+  WS ws_;
+  std::shared_ptr<RingBufferType> ringBuffer_;
+  FunctionEventHandler stepOneFunctionHandler_{FunctionStep::ONE};
+  FunctionEventHandler stepTwoFunctionHandler_{FunctionStep::TWO};
+  FunctionEventHandler stepThreeFunctionHandler_{FunctionStep::THREE};
+  std::shared_ptr<BarrierType> stepOneSequenceBarrier_;
+  std::shared_ptr<BarrierType> stepTwoSequenceBarrier_;
+  std::shared_ptr<BarrierType> stepThreeSequenceBarrier_;
+  std::shared_ptr<BatchProcessorType> stepOneBatchProcessor_;
+  std::shared_ptr<BatchProcessorType> stepTwoBatchProcessor_;
+  std::shared_ptr<BatchProcessorType> stepThreeBatchProcessor_;
+};
+
+const auto *registered =
+    disruptor::bench::perftest::registerDisruptorPerfTest<OneToThreePipelineSequencedThroughputTest>(
+        "PerfTest_OneToThreePipelineSequencedThroughputTest");
+
+} // namespace
@@ -0,0 +1,144 @@
+// 1:1 port of com.lmax.disruptor.sequenced.OneToThreeSequencedThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/sequenced/OneToThreeSequencedThroughputTest.java
+//
+// MultiCast a series of items between 1 publisher and 3 event processors.
+//
+//           +-----+
+//    +----->| EP1 |
+//    |      +-----+
+//    |
+// +----+    +-----+
+// | P1 |--->| EP2 |
+// +----+    +-----+
+//    |
+//    |      +-----+
+//    +----->| EP3 |
+//           +-----+
+//
+// Disruptor:
+// ==========
+//                             track to prevent wrap
+//             +--------------------+----------+----------+
+//             |                    |          |          |
+//             |                    v          v          v
+// +----+    +====+    +====+    +-----+    +-----+    +-----+
+// | P1 |--->| RB |<---| SB |    | EP1 |    | EP2 |    | EP3 |
+// +----+    +====+    +====+    +-----+    +-----+    +-----+
+//      claim      get    ^         |          |          |
+//                        |         |          |          |
+//                        +---------+----------+----------+
+//                                      waitFor
+//
+// P1  - Publisher 1
+// RB  - RingBuffer
+// SB  - SequenceBarrier
+// EP1 - EventProcessor 1
+// EP2 - EventProcessor 2
+// EP3 - EventProcessor 3
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+
+#include "perftest/support/AbstractPerfTestDisruptor.h"
+#include "perftest/support/Operation.h"
+#include "perftest/support/PerfTestUtil.h"
+#include "perftest/support/ValueEvent.h"
+#include "perftest/support/ValueMutationEventHandler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+
+constexpr int kNumEventProcessors = 3;
+constexpr int kBufferSize = 1024 * 8;
+constexpr int64_t kIterations = 1000L * 1000L * 100L;
+
+using disruptor::bench::perftest::support::Operation;
+
+class OneToThreeSequencedThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestDisruptor {
+public:
+  using PerfTestContext = disruptor::bench::perftest::PerfTestContext;
+  using ValueEvent = disruptor::bench::perftest::support::ValueEvent;
+  using ValueMutationEventHandler = disruptor::bench::perftest::support::ValueMutationEventHandler;
+  using WS = disruptor::YieldingWaitStrategy;
+  using RingBufferType = disruptor::RingBuffer<ValueEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<ValueEvent, BarrierType>;
+
+  OneToThreeSequencedThroughputTest()
+      : ringBuffer_(disruptor::SingleProducerRingBuffer<ValueEvent, WS>::createSingleProducer(
+            ValueEvent::EVENT_FACTORY, kBufferSize, ws_)),
+        sequenceBarrier_(ringBuffer_->newBarrier()) {
+    disruptor::BatchEventProcessorBuilder builder;
+    for (int i = 0; i < kNumEventProcessors; i++) {
+      batchEventProcessors_[i] = builder.build(*ringBuffer_, *sequenceBarrier_, handlers_[i]);
+      ringBuffer_->addGatingSequences(batchEventProcessors_[i]->getSequence());
+    }
+
+    for (int64_t i = 0; i < kIterations; i++) {
+      results_[0] = op(Operation::ADDITION, results_[0], i);
+      results_[1] = op(Operation::SUBTRACTION, results_[1], i);
+      results_[2] = op(Operation::AND, results_[2], i);
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  PerfTestContext runDisruptorPass() override {
+    PerfTestContext perfTestContext;
+    std::array<std::shared_ptr<std::atomic<bool>>, kNumEventProcessors> latches;
+    std::array<std::thread, kNumEventProcessors> threads;
+    for (int i = 0; i < kNumEventProcessors; i++) {
+      latches[i] = std::make_shared<std::atomic<bool>>(false);
+      handlers_[i].reset(latches[i], batchEventProcessors_[i]->getSequence().get() + kIterations);
+      threads[i] = std::thread([this, i] { batchEventProcessors_[i]->run(); });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < kIterations; i++) {
+      const int64_t sequence = ringBuffer_->next();
+      ringBuffer_->get(sequence).setValue(i);
+      ringBuffer_->publish(sequence);
+    }
+    for (auto &latch : latches) {
+      while (!latch->load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    perfTestContext.setDisruptorOps((kIterations * 1000L) / elapsedMs);
+    perfTestContext.setBatchData(handlers_[0].getBatchesProcessed(), kIterations);
+
+    for (int i = 0; i < kNumEventProcessors; i++) {
+      batchEventProcessors_[i]->halt();
+      threads[i].join();
+      disruptor::bench::perftest::support::failIfNot(results_[i], handlers_[i].getValue());
+    }
+    return perfTestContext;
+  }
+
+private:
+  WS ws_;
+  std::shared_ptr<RingBufferType> ringBuffer_;
+  std::shared_ptr<BarrierType> sequenceBarrier_;
+  std::array<ValueMutationEventHandler, kNumEventProcessors> handlers_{
+      ValueMutationEventHandler(Operation::ADDITION), ValueMutationEventHandler(Operation::SUBTRACTION),
+      ValueMutationEventHandler(Operation::AND)};
+  std::array<std::shared_ptr<BatchProcessorType>, kNumEventProcessors> batchEventProcessors_;
+  std::array<int64_t, kNumEventProcessors> results_{};
+};
+
+const auto *registered = disruptor::bench::perftest::registerDisruptorPerfTest<OneToThreeSequencedThroughputTest>(
+    "PerfTest_OneToThreeSequencedThroughputTest");
+
+} // namespace
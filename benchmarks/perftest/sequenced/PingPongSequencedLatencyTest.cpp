@@ -0,0 +1,214 @@
+// Port of com.lmax.disruptor.sequenced.PingPongSequencedLatencyTest
+//
+// Ping pongs between 2 event handlers and measures the round-trip latency.
+//
+// +----------+    +----------+
+// |          |--->|          |
+// |  Pinger  |    |  Ponger  |
+// |          |<---|          |
+// +----------+    +----------+
+//
+// Disruptor:
+// ==========
+//                   track to prevent wrap
+//             +-----------------+
+//             |                 |
+//             |                 v
+// +--------+  +======+  +=====+  +--------+
+// |        |->| PGRB |<-| PGB |  |        |
+// |        |  +======+  +=====+  |        |
+// | Pinger |                     | Ponger |
+// |        |  +======+  +=====+  |        |
+// |        |<-| PNRB |->| PNB |<-|        |
+// +--------+  +======+  +=====+  +--------+
+//             ^                 |
+//             |                 |
+//             +-----------------+
+//                track to prevent wrap
+//
+// PGRB - Ping RingBuffer, PGB - Ping SequenceBarrier
+// PNRB - Pong RingBuffer, PNB - Pong SequenceBarrier
+//
+// Runs once per wait strategy, unloaded and under background CPU load.
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/util/LatencyHistogram.h"
+#include "disruptor/util/Util.h"
+
+#include "perftest/support/LatencyTestSupport.h"
+#include "perftest/support/ValueEvent.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace {
+
+constexpr int kBufferSize = 1024;
+constexpr int64_t kIterations = 1000L * 1000L;
+constexpr int64_t kPauseNanos = 1000L;
+constexpr int kRuns = 3;
+
+using disruptor::bench::perftest::support::LoadCondition;
+using disruptor::bench::perftest::support::ValueEvent;
+
+template <typename RingBufferT> class Pinger final : public disruptor::EventHandler<ValueEvent> {
+public:
+  explicit Pinger(RingBufferT &buffer) : buffer_(buffer) {}
+
+  // Java: reset(CyclicBarrier barrier, CountDownLatch latch, Histogram histogram)
+  void reset(std::atomic<bool> &startSignal, std::atomic<bool> &latch, disruptor::util::LatencyHistogram &histogram) {
+    startSignal_ = &startSignal;
+    latch_ = &latch;
+    histogram_ = &histogram;
+    counter_ = 0;
+  }
+
+  void onEvent(ValueEvent &event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    const int64_t t1 = disruptor::util::Util::nanoTime();
+    histogram_->record(t1 - t0_);
+
+    if (event.getValue() < kIterations) {
+      while (kPauseNanos > (disruptor::util::Util::nanoTime() - t1)) {
+        std::this_thread::yield();
+      }
+      send();
+    } else {
+      latch_->store(true, std::memory_order_release);
+    }
+  }
+
+  // Java: barrier.await(); Thread.sleep(1000); send();
+  void onStart() override {
+    while (!startSignal_->load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    send();
+  }
+
+private:
+  void send() {
+    t0_ = disruptor::util::Util::nanoTime();
+    const int64_t next = buffer_.next();
+    buffer_.get(next).setValue(counter_);
+    buffer_.publish(next);
+    counter_++;
+  }
+
+  RingBufferT &buffer_;
+  std::atomic<bool> *startSignal_{nullptr};
+  std::atomic<bool> *latch_{nullptr};
+  disruptor::util::LatencyHistogram *histogram_{nullptr};
+  int64_t t0_{0};
+  int64_t counter_{0};
+};
+
+template <typename RingBufferT> class Ponger final : public disruptor::EventHandler<ValueEvent> {
+public:
+  explicit Ponger(RingBufferT &buffer) : buffer_(buffer) {}
+
+  void onEvent(ValueEvent &event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    const int64_t next = buffer_.next();
+    buffer_.get(next).setValue(event.getValue());
+    buffer_.publish(next);
+  }
+
+private:
+  RingBufferT &buffer_;
+};
+
+template <typename WS> class PingPongSequencedLatencyTest {
+public:
+  using RingBufferType = disruptor::RingBuffer<ValueEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<ValueEvent, BarrierType>;
+
+  PingPongSequencedLatencyTest()
+      : pingWs_(disruptor::bench::perftest::support::newWaitStrategy<WS>()),
+        pongWs_(disruptor::bench::perftest::support::newWaitStrategy<WS>()),
+        pingBuffer_(disruptor::SingleProducerRingBuffer<ValueEvent, WS>::createSingleProducer(
+            ValueEvent::EVENT_FACTORY, kBufferSize, *pingWs_)),
+        pongBuffer_(disruptor::SingleProducerRingBuffer<ValueEvent, WS>::createSingleProducer(
+            ValueEvent::EVENT_FACTORY, kBufferSize, *pongWs_)),
+        pingBarrier_(pingBuffer_->newBarrier()),
+        pongBarrier_(pongBuffer_->newBarrier()),
+        pinger_(*pingBuffer_),
+        ponger_(*pongBuffer_) {
+    disruptor::BatchEventProcessorBuilder builder;
+    pingProcessor_ = builder.build(*pongBuffer_, *pongBarrier_, pinger_);
+    pongProcessor_ = builder.build(*pingBuffer_, *pingBarrier_, ponger_);
+    pingBuffer_->addGatingSequences(pongProcessor_->getSequence());
+    pongBuffer_->addGatingSequences(pingProcessor_->getSequence());
+  }
+
+  void runDisruptorPass(disruptor::util::LatencyHistogram &histogram) {
+    std::atomic<bool> startSignal{false};
+    std::atomic<bool> latch{false};
+    pinger_.reset(startSignal, latch, histogram);
+
+    std::thread pingThread([this] { pingProcessor_->run(); });
+    std::thread pongThread([this] { pongProcessor_->run(); });
+    while (!pingProcessor_->isRunning() || !pongProcessor_->isRunning()) {
+      std::this_thread::yield();
+    }
+    startSignal.store(true, std::memory_order_release);
+
+    while (!latch.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    pingProcessor_->halt();
+    pongProcessor_->halt();
+    pingThread.join();
+    pongThread.join();
+  }
+
+private:
+  std::unique_ptr<WS> pingWs_;
+  std::unique_ptr<WS> pongWs_;
+  std::shared_ptr<RingBufferType> pingBuffer_;
+  std::shared_ptr<RingBufferType> pongBuffer_;
+  std::shared_ptr<BarrierType> pingBarrier_;
+  std::shared_ptr<BarrierType> pongBarrier_;
+  Pinger<RingBufferType> pinger_;
+  Ponger<RingBufferType> ponger_;
+  std::shared_ptr<BatchProcessorType> pingProcessor_;
+  std::shared_ptr<BatchProcessorType> pongProcessor_;
+};
+
+template <typename WS>
+void PerfTest_PingPongSequencedLatencyTest(benchmark::State &state, const std::string &name,
+                                           LoadCondition condition) {
+  PingPongSequencedLatencyTest<WS> test;
+  disruptor::util::LatencyHistogram histogram;
+  disruptor::bench::perftest::support::BackgroundLoad load(condition);
+
+  for (auto _ : state) {
+    test.runDisruptorPass(histogram);
+  }
+  disruptor::bench::perftest::support::reportLatency(state, name.c_str(), histogram);
+}
+
+const int registered = [] {
+  disruptor::bench::perftest::support::forEachWaitStrategy([](auto type, const char *wsName) {
+    using WS = typename decltype(type)::type;
+    for (auto condition : {LoadCondition::UNLOADED, LoadCondition::LOADED}) {
+      const std::string name = std::string("PerfTest_PingPongSequencedLatencyTest/") + wsName + "/" +
+                               disruptor::bench::perftest::support::toString(condition);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   [name, condition](benchmark::State &state) {
+                                     PerfTest_PingPongSequencedLatencyTest<WS>(state, name, condition);
+                                   })
+          ->Unit(benchmark::kMillisecond)
+          ->Iterations(kRuns)
+          ->UseRealTime();
+    }
+  });
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,137 @@
+// 1:1 port of com.lmax.disruptor.sequenced.ThreeToOneSequencedThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/sequenced/ThreeToOneSequencedThroughputTest.java
+//
+// Sequence a series of events from multiple publishers going to one event processor.
+//
+// +----+
+// | P1 |------+
+// +----+      |
+//             v
+// +----+    +-----+
+// | P1 |--->| EP1 |
+// +----+    +-----+
+//             ^
+// +----+      |
+// | P3 |------+
+// +----+
+//
+// Disruptor:
+// ==========
+//             track to prevent wrap
+//             +--------------------+
+//             |                    |
+//             |                    v
+// +----+    +====+    +====+    +-----+
+// | P1 |--->| RB |<---| SB |    | EP1 |
+// +----+    +====+    +====+    +-----+
+//             ^   get    ^         |
+// +----+      |          |         |
+// | P2 |------+          +---------+
+// +----+      |            waitFor
+//             |
+// +----+      |
+// | P3 |------+
+// +----+
+//
+// P1  - Publisher 1
+// P2  - Publisher 2
+// P3  - Publisher 3
+// RB  - RingBuffer
+// SB  - SequenceBarrier
+// EP1 - EventProcessor 1
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+
+#include "perftest/support/AbstractPerfTestDisruptor.h"
+#include "perftest/support/ValueAdditionEventHandler.h"
+#include "perftest/support/ValueEvent.h"
+#include "perftest/support/ValuePublisher.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+
+constexpr int kNumPublishers = 3;
+constexpr int kBufferSize = 1024 * 64;
+constexpr int64_t kIterations = 1000L * 1000L * 20L;
+
+class ThreeToOneSequencedThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestDisruptor {
+public:
+  using PerfTestContext = disruptor::bench::perftest::PerfTestContext;
+  using ValueEvent = disruptor::bench::perftest::support::ValueEvent;
+  using ValueAdditionEventHandler = disruptor::bench::perftest::support::ValueAdditionEventHandler;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RingBufferType = disruptor::RingBuffer<ValueEvent, disruptor::MultiProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::MultiProducerSequencer<WS>, WS>;
+  using BatchProcessorType = disruptor::BatchEventProcessor<ValueEvent, BarrierType>;
+  using ValuePublisher = disruptor::bench::perftest::support::ValuePublisher<RingBufferType>;
+
+  ThreeToOneSequencedThroughputTest()
+      : ringBuffer_(disruptor::MultiProducerRingBuffer<ValueEvent, WS>::createMultiProducer(
+            ValueEvent::EVENT_FACTORY, kBufferSize, ws_)),
+        sequenceBarrier_(ringBuffer_->newBarrier()),
+        batchEventProcessor_([this]() {
+          disruptor::BatchEventProcessorBuilder builder;
+          return builder.build(*ringBuffer_, *sequenceBarrier_, handler_);
+        }()) {
+    ringBuffer_->addGatingSequences(batchEventProcessor_->getSequence());
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  PerfTestContext runDisruptorPass() override {
+    PerfTestContext perfTestContext;
+    auto latch = std::make_shared<std::atomic<bool>>(false);
+    const int64_t expectedCount =
+        batchEventProcessor_->getSequence().get() + ((kIterations / kNumPublishers) * kNumPublishers);
+    handler_.reset(latch, expectedCount);
+
+    std::atomic<bool> startSignal{false};
+    std::array<std::thread, kNumPublishers> publishers;
+    for (auto &publisher : publishers) {
+      publisher = std::thread([this, &startSignal] {
+        ValuePublisher(startSignal, *ringBuffer_, kIterations / kNumPublishers).run();
+      });
+    }
+    std::thread processorThread([this] { batchEventProcessor_->run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    startSignal.store(true, std::memory_order_release);
+    while (!latch->load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    perfTestContext.setDisruptorOps((kIterations * 1000L) / elapsedMs);
+    perfTestContext.setBatchData(handler_.getBatchesProcessed(), kIterations);
+
+    for (auto &publisher : publishers) {
+      publisher.join();
+    }
+    batchEventProcessor_->halt();
+    processorThread.join();
+    return perfTestContext;
+  }
+
+private:
+  WS ws_;
+  std::shared_ptr<RingBufferType> ringBuffer_;
+  std::shared_ptr<BarrierType> sequenceBarrier_;
+  ValueAdditionEventHandler handler_;
+  std::shared_ptr<BatchProcessorType> batchEventProcessor_;
+};
+
+const auto *registered = disruptor::bench::perftest::registerDisruptorPerfTest<ThreeToOneSequencedThroughputTest>(
+    "PerfTest_ThreeToOneSequencedThroughputTest");
+
+} // namespace
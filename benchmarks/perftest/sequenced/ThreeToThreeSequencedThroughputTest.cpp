@@ -0,0 +1,133 @@
+// 1:1 port of com.lmax.disruptor.sequenced.ThreeToThreeSequencedThroughputTest
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/sequenced/ThreeToThreeSequencedThroughputTest.java
+//
+// Sequence a series of events from multiple publishers going to one event
+// processor, each publisher owning its own ring buffer.
+//
+// Disruptor:
+// ==========
+//             track to prevent wrap
+//             +--------------------+
+//             |                    |
+//             |                    |
+// +----+    +====+    +====+       |
+// | P1 |--->| RB |--->| SB |--+    |
+// +----+    +====+    +====+  |    |
+//                             |    v
+// +----+    +====+    +====+  | +----+
+// | P2 |--->| RB |--->| SB |--+>| EP |
+// +----+    +====+    +====+  | +----+
+//                             |
+// +----+    +====+    +====+  |
+// | P3 |--->| RB |--->| SB |--+
+// +----+    +====+    +====+
+//
+// P1 - Publisher 1
+// P2 - Publisher 2
+// P3 - Publisher 3
+// RB - RingBuffer
+// SB - SequenceBarrier
+// EP - EventProcessor
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/RingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+
+#include "perftest/support/AbstractPerfTestDisruptor.h"
+#include "perftest/support/LongArrayEvent.h"
+#include "perftest/support/MultiBufferBatchEventProcessor.h"
+#include "perftest/support/PerfTestUtil.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kNumPublishers = 3;
+constexpr int kBufferSize = 1024 * 64;
+constexpr int64_t kIterations = 1000L * 1000L * 180L;
+
+class ThreeToThreeSequencedThroughputTest final : public disruptor::bench::perftest::AbstractPerfTestDisruptor {
+public:
+  using PerfTestContext = disruptor::bench::perftest::PerfTestContext;
+  using LongArrayEvent = disruptor::bench::perftest::support::LongArrayEvent;
+  using LongArrayEventHandler = disruptor::bench::perftest::support::LongArrayEventHandler;
+  using WS = disruptor::YieldingWaitStrategy;
+  using RingBufferType = disruptor::RingBuffer<LongArrayEvent, disruptor::SingleProducerSequencer<WS>>;
+  using BarrierType = disruptor::ProcessingSequenceBarrier<disruptor::SingleProducerSequencer<WS>, WS>;
+  using ProcessorType =
+      disruptor::bench::perftest::support::MultiBufferBatchEventProcessor<LongArrayEvent, RingBufferType, BarrierType>;
+  using LongArrayPublisher = disruptor::bench::perftest::support::LongArrayPublisher<RingBufferType>;
+
+  ThreeToThreeSequencedThroughputTest() {
+    std::vector<RingBufferType *> providers;
+    std::vector<BarrierType *> barriers;
+    for (int i = 0; i < kNumPublishers; i++) {
+      buffers_[i] = disruptor::SingleProducerRingBuffer<LongArrayEvent, WS>::createSingleProducer(
+          disruptor::bench::perftest::support::LONG_ARRAY_EVENT_FACTORY, kBufferSize, waitStrategies_[i]);
+      barriers_[i] = buffers_[i]->newBarrier();
+      providers.push_back(buffers_[i].get());
+      barriers.push_back(barriers_[i].get());
+    }
+
+    batchEventProcessor_ = std::make_unique<ProcessorType>(providers, barriers, handler_);
+    for (int i = 0; i < kNumPublishers; i++) {
+      buffers_[i]->addGatingSequences(batchEventProcessor_->getSequence(i));
+    }
+  }
+
+  int getRequiredProcessorCount() const override { return 4; }
+
+  PerfTestContext runDisruptorPass() override {
+    PerfTestContext perfTestContext;
+    auto latch = std::make_shared<std::atomic<bool>>(false);
+    handler_.reset(latch, (kIterations / kNumPublishers) * kNumPublishers);
+
+    std::atomic<bool> startSignal{false};
+    std::array<std::thread, kNumPublishers> publishers;
+    for (int i = 0; i < kNumPublishers; i++) {
+      publishers[i] = std::thread([this, i, &startSignal] {
+        LongArrayPublisher(startSignal, *buffers_[i], kIterations / kNumPublishers).run();
+      });
+    }
+    std::thread processorThread([this] { batchEventProcessor_->run(); });
+
+    const auto start = std::chrono::steady_clock::now();
+    startSignal.store(true, std::memory_order_release);
+    while (!latch->load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    const auto elapsedMs = std::max<int64_t>(
+        1, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    perfTestContext.setDisruptorOps((kIterations * 1000L) / elapsedMs);
+
+    for (auto &publisher : publishers) {
+      publisher.join();
+    }
+    batchEventProcessor_->halt();
+    processorThread.join();
+
+    const int64_t expected = disruptor::bench::perftest::support::accumulatedAddition(kIterations / kNumPublishers) *
+                             kNumPublishers * disruptor::bench::perftest::support::LONG_ARRAY_SIZE;
+    disruptor::bench::perftest::support::failIfNot(expected, handler_.getValue());
+    return perfTestContext;
+  }
+
+private:
+  std::array<WS, kNumPublishers> waitStrategies_;
+  std::array<std::shared_ptr<RingBufferType>, kNumPublishers> buffers_;
+  std::array<std::shared_ptr<BarrierType>, kNumPublishers> barriers_;
+  LongArrayEventHandler handler_;
+  std::unique_ptr<ProcessorType> batchEventProcessor_;
+};
+
+const auto *registered = disruptor::bench::perftest::registerDisruptorPerfTest<ThreeToThreeSequencedThroughputTest>(
+    "PerfTest_ThreeToThreeSequencedThroughputTest");
+
+} // namespace
@@ -0,0 +1,61 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.AbstractPerfTestDisruptor
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/AbstractPerfTestDisruptor.java
+//
+// Google Benchmark glue: one benchmark iteration is one Java run, so each
+// test is registered with Iterations(RUNS) and prints Java's per-run line.
+
+#include <benchmark/benchmark.h>
+
+#include "PerfTestContext.h"
+
+#include <cstdio>
+#include <thread>
+
+namespace disruptor::bench::perftest {
+
+class AbstractPerfTestDisruptor {
+public:
+  static constexpr int RUNS = 7;
+
+  virtual ~AbstractPerfTestDisruptor() = default;
+
+  virtual int getRequiredProcessorCount() const = 0;
+
+  virtual PerfTestContext runDisruptorPass() = 0;
+};
+
+inline void warnIfInsufficientProcessors(int requiredProcessorCount) {
+  const int availableProcessors = static_cast<int>(std::thread::hardware_concurrency());
+  if (requiredProcessorCount > availableProcessors) {
+    std::printf("*** Warning ***: your system has insufficient processors to execute the test efficiently. ");
+    std::printf("Processors required = %d available = %d\n", requiredProcessorCount, availableProcessors);
+  }
+}
+
+// Java: testImplementations() - the test is constructed once and reused across runs.
+template <typename TestT> void runDisruptorPerfTest(benchmark::State &state) {
+  TestT test;
+  warnIfInsufficientProcessors(test.getRequiredProcessorCount());
+  std::printf("Starting Disruptor tests\n");
+
+  int run = 0;
+  for (auto _ : state) {
+    PerfTestContext context = test.runDisruptorPass();
+    std::printf("Run %d, Disruptor=%lld ops/sec BatchPercent=%.2f%% AverageBatchSize=%.0f\n", run++,
+                static_cast<long long>(context.getDisruptorOps()), context.getBatchPercent() * 100.0,
+                context.getAverageBatchSize());
+
+    state.counters["ops_per_sec"] = benchmark::Counter(static_cast<double>(context.getDisruptorOps()));
+    state.counters["batch_percent"] = benchmark::Counter(context.getBatchPercent() * 100.0);
+    state.counters["avg_batch_size"] = benchmark::Counter(context.getAverageBatchSize());
+  }
+}
+
+template <typename TestT> benchmark::internal::Benchmark *registerDisruptorPerfTest(const char *name) {
+  return benchmark::RegisterBenchmark(name, &runDisruptorPerfTest<TestT>)
+      ->Unit(benchmark::kMillisecond)
+      ->Iterations(AbstractPerfTestDisruptor::RUNS);
+}
+
+} // namespace disruptor::bench::perftest
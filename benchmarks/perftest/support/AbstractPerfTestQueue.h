@@ -0,0 +1,47 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.AbstractPerfTestQueue
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/AbstractPerfTestQueue.java
+//
+// Queue baselines run the same topologies over support::BlockingQueue
+// (std::mutex + std::deque) so results can be read next to the Disruptor ones.
+
+#include <benchmark/benchmark.h>
+
+#include "AbstractPerfTestDisruptor.h"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace disruptor::bench::perftest {
+
+class AbstractPerfTestQueue {
+public:
+  static constexpr int RUNS = 7;
+
+  virtual ~AbstractPerfTestQueue() = default;
+
+  virtual int getRequiredProcessorCount() const = 0;
+
+  virtual int64_t runQueuePass() = 0;
+};
+
+template <typename TestT> void runQueuePerfTest(benchmark::State &state) {
+  TestT test;
+  warnIfInsufficientProcessors(test.getRequiredProcessorCount());
+  std::printf("Starting Queue tests\n");
+
+  int run = 0;
+  for (auto _ : state) {
+    const int64_t ops = test.runQueuePass();
+    std::printf("Run %d, BlockingQueue=%lld ops/sec\n", run++, static_cast<long long>(ops));
+    state.counters["ops_per_sec"] = benchmark::Counter(static_cast<double>(ops));
+  }
+}
+
+template <typename TestT> benchmark::internal::Benchmark *registerQueuePerfTest(const char *name) {
+  return benchmark::RegisterBenchmark(name, &runQueuePerfTest<TestT>)
+      ->Unit(benchmark::kMillisecond)
+      ->Iterations(AbstractPerfTestQueue::RUNS);
+}
+
+} // namespace disruptor::bench::perftest
@@ -0,0 +1,70 @@
+#pragma once
+// Bounded blocking queue used by the queue baselines (stands in for Java's
+// LinkedBlockingQueue / ArrayBlockingQueue in the perftest queue package).
+// Deliberately the obvious std::mutex + std::deque implementation.
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace disruptor::bench::perftest::support {
+
+template <typename T> class BlockingQueue {
+public:
+  explicit BlockingQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  void put(const T &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notFull_.wait(lock, [this] { return queue_.size() < capacity_; });
+    queue_.push_back(value);
+    lock.unlock();
+    notEmpty_.notify_one();
+  }
+
+  // Batch publish: one lock acquisition for the whole batch.
+  template <typename It> void putAll(It first, It last) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (; first != last; ++first) {
+      if (queue_.size() >= capacity_) {
+        notEmpty_.notify_one();
+        notFull_.wait(lock, [this] { return queue_.size() < capacity_; });
+      }
+      queue_.push_back(*first);
+    }
+    lock.unlock();
+    notEmpty_.notify_one();
+  }
+
+  T take() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notEmpty_.wait(lock, [this] { return !queue_.empty(); });
+    T value = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    notFull_.notify_one();
+    return value;
+  }
+
+  // Java: poll() - non-blocking take.
+  bool poll(T &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    value = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    notFull_.notify_one();
+    return true;
+  }
+
+private:
+  const std::size_t capacity_;
+  std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+  std::deque<T> queue_;
+};
+
+} // namespace disruptor::bench::perftest::support
@@ -0,0 +1,43 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.FizzBuzzEvent
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/FizzBuzzEvent.java
+
+#include "disruptor/EventFactory.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace disruptor::bench::perftest::support {
+
+class FizzBuzzEvent {
+public:
+  int64_t getValue() const { return value_; }
+  void setValue(int64_t value) {
+    fizz_ = false;
+    buzz_ = false;
+    value_ = value;
+  }
+
+  bool isFizz() const { return fizz_; }
+  void setFizz(bool fizz) { fizz_ = fizz; }
+
+  bool isBuzz() const { return buzz_; }
+  void setBuzz(bool buzz) { buzz_ = buzz; }
+
+  static std::shared_ptr<disruptor::EventFactory<FizzBuzzEvent>> EVENT_FACTORY;
+
+private:
+  bool fizz_{false};
+  bool buzz_{false};
+  int64_t value_{0};
+};
+
+class FizzBuzzEventFactory : public disruptor::EventFactory<FizzBuzzEvent> {
+public:
+  FizzBuzzEvent newInstance() override { return FizzBuzzEvent(); }
+};
+
+inline std::shared_ptr<disruptor::EventFactory<FizzBuzzEvent>> FizzBuzzEvent::EVENT_FACTORY =
+    std::make_shared<FizzBuzzEventFactory>();
+
+} // namespace disruptor::bench::perftest::support
@@ -0,0 +1,67 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.FizzBuzzEventHandler (and FizzBuzzStep)
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/FizzBuzzEventHandler.java
+
+#include "disruptor/EventHandler.h"
+#include "FizzBuzzEvent.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace disruptor::bench::perftest::support {
+
+enum class FizzBuzzStep { FIZZ, BUZZ, FIZZ_BUZZ };
+
+class FizzBuzzEventHandler : public disruptor::EventHandler<FizzBuzzEvent> {
+public:
+  explicit FizzBuzzEventHandler(FizzBuzzStep fizzBuzzStep) : fizzBuzzStep_(fizzBuzzStep) {}
+
+  int64_t getFizzBuzzCounter() const { return fizzBuzzCounter_.load(std::memory_order_acquire); }
+
+  int64_t getBatchesProcessed() const { return batchesProcessed_.load(std::memory_order_acquire); }
+
+  void reset(std::shared_ptr<std::atomic<bool>> latch, int64_t expectedCount) {
+    fizzBuzzCounter_.store(0, std::memory_order_release);
+    latch_ = std::move(latch);
+    count_ = expectedCount;
+    batchesProcessed_.store(0, std::memory_order_release);
+  }
+
+  void onEvent(FizzBuzzEvent &event, int64_t sequence, bool /*endOfBatch*/) override {
+    switch (fizzBuzzStep_) {
+    case FizzBuzzStep::FIZZ:
+      if (0 == (event.getValue() % 3)) {
+        event.setFizz(true);
+      }
+      break;
+    case FizzBuzzStep::BUZZ:
+      if (0 == (event.getValue() % 5)) {
+        event.setBuzz(true);
+      }
+      break;
+    case FizzBuzzStep::FIZZ_BUZZ:
+      if (event.isFizz() && event.isBuzz()) {
+        fizzBuzzCounter_.store(fizzBuzzCounter_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+      }
+      break;
+    }
+
+    if (latch_ && count_ == sequence) {
+      latch_->store(true, std::memory_order_release);
+    }
+  }
+
+  void onBatchStart(int64_t /*batchSize*/, int64_t /*queueDepth*/) override {
+    batchesProcessed_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+private:
+  const FizzBuzzStep fizzBuzzStep_;
+  std::atomic<int64_t> fizzBuzzCounter_{0};
+  std::atomic<int64_t> batchesProcessed_{0};
+  int64_t count_{-1};
+  std::shared_ptr<std::atomic<bool>> latch_;
+};
+
+} // namespace disruptor::bench::perftest::support
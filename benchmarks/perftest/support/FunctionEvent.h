@@ -0,0 +1,43 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.FunctionEvent
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/FunctionEvent.java
+
+#include "disruptor/EventFactory.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace disruptor::bench::perftest::support {
+
+class FunctionEvent {
+public:
+  int64_t getOperandOne() const { return operandOne_; }
+  void setOperandOne(int64_t operandOne) { operandOne_ = operandOne; }
+
+  int64_t getOperandTwo() const { return operandTwo_; }
+  void setOperandTwo(int64_t operandTwo) { operandTwo_ = operandTwo; }
+
+  int64_t getStepOneResult() const { return stepOneResult_; }
+  void setStepOneResult(int64_t stepOneResult) { stepOneResult_ = stepOneResult; }
+
+  int64_t getStepTwoResult() const { return stepTwoResult_; }
+  void setStepTwoResult(int64_t stepTwoResult) { stepTwoResult_ = stepTwoResult; }
+
+  static std::shared_ptr<disruptor::EventFactory<FunctionEvent>> EVENT_FACTORY;
+
+private:
+  int64_t operandOne_{0};
+  int64_t operandTwo_{0};
+  int64_t stepOneResult_{0};
+  int64_t stepTwoResult_{0};
+};
+
+class FunctionEventFactory : public disruptor::EventFactory<FunctionEvent> {
+public:
+  FunctionEvent newInstance() override { return FunctionEvent(); }
+};
+
+inline std::shared_ptr<disruptor::EventFactory<FunctionEvent>> FunctionEvent::EVENT_FACTORY =
+    std::make_shared<FunctionEventFactory>();
+
+} // namespace disruptor::bench::perftest::support
@@ -0,0 +1,63 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.FunctionEventHandler (and FunctionStep)
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/FunctionEventHandler.java
+
+#include "disruptor/EventHandler.h"
+#include "FunctionEvent.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace disruptor::bench::perftest::support {
+
+enum class FunctionStep { ONE, TWO, THREE };
+
+class FunctionEventHandler : public disruptor::EventHandler<FunctionEvent> {
+public:
+  explicit FunctionEventHandler(FunctionStep functionStep) : functionStep_(functionStep) {}
+
+  int64_t getStepThreeCounter() const { return stepThreeCounter_.load(std::memory_order_acquire); }
+
+  int64_t getBatchesProcessed() const { return batchesProcessed_.load(std::memory_order_acquire); }
+
+  void reset(std::shared_ptr<std::atomic<bool>> latch, int64_t expectedCount) {
+    stepThreeCounter_.store(0, std::memory_order_release);
+    latch_ = std::move(latch);
+    count_ = expectedCount;
+    batchesProcessed_.store(0, std::memory_order_release);
+  }
+
+  void onEvent(FunctionEvent &event, int64_t sequence, bool /*endOfBatch*/) override {
+    switch (functionStep_) {
+    case FunctionStep::ONE:
+      event.setStepOneResult(event.getOperandOne() + event.getOperandTwo());
+      break;
+    case FunctionStep::TWO:
+      event.setStepTwoResult(event.getStepOneResult() + 3L);
+      break;
+    case FunctionStep::THREE:
+      if ((event.getStepTwoResult() & 4L) == 4L) {
+        stepThreeCounter_.store(stepThreeCounter_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+      }
+      break;
+    }
+
+    if (latch_ && count_ == sequence) {
+      latch_->store(true, std::memory_order_release);
+    }
+  }
+
+  void onBatchStart(int64_t /*batchSize*/, int64_t /*queueDepth*/) override {
+    batchesProcessed_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+private:
+  const FunctionStep functionStep_;
+  std::atomic<int64_t> stepThreeCounter_{0};
+  std::atomic<int64_t> batchesProcessed_{0};
+  int64_t count_{-1};
+  std::shared_ptr<std::atomic<bool>> latch_;
+};
+
+} // namespace disruptor::bench::perftest::support
@@ -0,0 +1,139 @@
+#pragma once
+// Shared helpers for the latency perftests. Java's latency tests record into
+// an HdrHistogram and print it; here we record into
+// disruptor::util::LatencyHistogram and report the tail percentiles as Google
+// Benchmark counters.
+
+#include <benchmark/benchmark.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/LiteBlockingWaitStrategy.h"
+#include "disruptor/LiteTimeoutBlockingWaitStrategy.h"
+#include "disruptor/PhasedBackoffWaitStrategy.h"
+#include "disruptor/SleepingWaitStrategy.h"
+#include "disruptor/TimeoutBlockingWaitStrategy.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/util/LatencyHistogram.h"
+#include "disruptor/util/Util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace disruptor::bench::perftest::support {
+
+// UNLOADED: only the threads under test are running.
+// LOADED: one CPU-bound background thread per hardware thread competes with
+// the threads under test, so scheduling delays show up in the tail.
+enum class LoadCondition { UNLOADED, LOADED };
+
+inline const char *toString(LoadCondition condition) {
+  return condition == LoadCondition::LOADED ? "loaded" : "unloaded";
+}
+
+class BackgroundLoad {
+public:
+  explicit BackgroundLoad(LoadCondition condition) {
+    if (condition != LoadCondition::LOADED) {
+      return;
+    }
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < threads; ++i) {
+      threads_.emplace_back([this] {
+        uint64_t x = 0x9E3779B97F4A7C15ULL;
+        while (running_.load(std::memory_order_relaxed)) {
+          // xorshift keeps the core busy without touching shared memory
+          x ^= x << 13;
+          x ^= x >> 7;
+          x ^= x << 17;
+        }
+        sink_.fetch_add(x, std::memory_order_relaxed);
+      });
+    }
+  }
+
+  ~BackgroundLoad() {
+    running_.store(false, std::memory_order_relaxed);
+    for (auto &t : threads_) {
+      t.join();
+    }
+  }
+
+  BackgroundLoad(const BackgroundLoad &) = delete;
+  BackgroundLoad &operator=(const BackgroundLoad &) = delete;
+
+private:
+  std::atomic<bool> running_{true};
+  std::atomic<uint64_t> sink_{0};
+  std::vector<std::thread> threads_;
+};
+
+// Java: while (pauseStart + PAUSE_NANOS > System.nanoTime()) { /* busy spin */ }
+inline void busySpinFor(int64_t pauseNanos) {
+  const int64_t pauseStart = disruptor::util::Util::nanoTime();
+  while (pauseStart + pauseNanos > disruptor::util::Util::nanoTime()) {
+    // busy spin
+  }
+}
+
+// Every wait strategy in include/disruptor, constructed with the settings a
+// latency-sensitive deployment would use. Strategies hold mutexes and condition
+// variables, so they are created in place rather than returned by value.
+template <typename WS> std::unique_ptr<WS> newWaitStrategy() { return std::make_unique<WS>(); }
+
+template <> inline std::unique_ptr<disruptor::TimeoutBlockingWaitStrategy> newWaitStrategy() {
+  return std::make_unique<disruptor::TimeoutBlockingWaitStrategy>(1000L * 1000L);
+}
+
+template <> inline std::unique_ptr<disruptor::LiteTimeoutBlockingWaitStrategy> newWaitStrategy() {
+  return std::make_unique<disruptor::LiteTimeoutBlockingWaitStrategy>(1000L * 1000L);
+}
+
+template <>
+inline std::unique_ptr<disruptor::PhasedBackoffWaitStrategy<disruptor::SleepingWaitStrategy>> newWaitStrategy() {
+  return std::make_unique<disruptor::PhasedBackoffWaitStrategy<disruptor::SleepingWaitStrategy>>(
+      1000L, 1000L * 1000L, disruptor::SleepingWaitStrategy(0));
+}
+
+// Calls f(std::type_identity<WS>{}, "WaitStrategyName") for every strategy,
+// so each latency test registers one benchmark per strategy and condition.
+template <typename F> void forEachWaitStrategy(F &&f) {
+  f(std::type_identity<disruptor::BusySpinWaitStrategy>{}, "BusySpinWaitStrategy");
+  f(std::type_identity<disruptor::YieldingWaitStrategy>{}, "YieldingWaitStrategy");
+  f(std::type_identity<disruptor::SleepingWaitStrategy>{}, "SleepingWaitStrategy");
+  f(std::type_identity<disruptor::BlockingWaitStrategy>{}, "BlockingWaitStrategy");
+  f(std::type_identity<disruptor::LiteBlockingWaitStrategy>{}, "LiteBlockingWaitStrategy");
+  f(std::type_identity<disruptor::TimeoutBlockingWaitStrategy>{}, "TimeoutBlockingWaitStrategy");
+  f(std::type_identity<disruptor::LiteTimeoutBlockingWaitStrategy>{}, "LiteTimeoutBlockingWaitStrategy");
+  f(std::type_identity<disruptor::PhasedBackoffWaitStrategy<disruptor::SleepingWaitStrategy>>{},
+    "PhasedBackoffWaitStrategy");
+}
+
+// Java: histogram.outputPercentileDistribution(System.out, 1000.0) - we print
+// the percentiles that matter for an SLA and expose them as counters (ns).
+inline void reportLatency(benchmark::State &state, const char *name,
+                          const disruptor::util::LatencyHistogram &histogram) {
+  const auto p50 = histogram.getValueAtPercentile(50.0);
+  const auto p99 = histogram.getValueAtPercentile(99.0);
+  const auto p999 = histogram.getValueAtPercentile(99.9);
+  const auto p9999 = histogram.getValueAtPercentile(99.99);
+  std::printf("%s count=%lld mean=%.0fns p50=%lldns p99=%lldns p99.9=%lldns p99.99=%lldns max=%lldns\n", name,
+              static_cast<long long>(histogram.getTotalCount()), histogram.getMean(), static_cast<long long>(p50),
+              static_cast<long long>(p99), static_cast<long long>(p999), static_cast<long long>(p9999),
+              static_cast<long long>(histogram.getMax()));
+
+  state.counters["p50_ns"] = benchmark::Counter(static_cast<double>(p50));
+  state.counters["p99_ns"] = benchmark::Counter(static_cast<double>(p99));
+  state.counters["p99_9_ns"] = benchmark::Counter(static_cast<double>(p999));
+  state.counters["p99_99_ns"] = benchmark::Counter(static_cast<double>(p9999));
+  state.counters["max_ns"] = benchmark::Counter(static_cast<double>(histogram.getMax()));
+  state.counters["mean_ns"] = benchmark::Counter(histogram.getMean());
+}
+
+} // namespace disruptor::bench::perftest::support
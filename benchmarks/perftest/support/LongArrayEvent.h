@@ -0,0 +1,81 @@
+#pragma once
+// Event type for the long[] perftests. Java publishes raw long[ARRAY_SIZE]
+// arrays; a fixed-size std::array keeps the ring buffer slots inline.
+// Sources: support/LongArrayPublisher.java, support/LongArrayEventHandler.java
+
+#include "disruptor/EventFactory.h"
+#include "disruptor/EventHandler.h"
+#include "ValuePublisher.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace disruptor::bench::perftest::support {
+
+constexpr int LONG_ARRAY_SIZE = 3;
+using LongArrayEvent = std::array<int64_t, LONG_ARRAY_SIZE>;
+
+class LongArrayEventFactory : public disruptor::EventFactory<LongArrayEvent> {
+public:
+  LongArrayEvent newInstance() override { return LongArrayEvent{}; }
+};
+
+inline std::shared_ptr<disruptor::EventFactory<LongArrayEvent>> LONG_ARRAY_EVENT_FACTORY =
+    std::make_shared<LongArrayEventFactory>();
+
+// 1:1 port of com.lmax.disruptor.support.LongArrayPublisher
+template <typename RingBufferT> class LongArrayPublisher {
+public:
+  LongArrayPublisher(const std::atomic<bool> &startSignal, RingBufferT &ringBuffer, int64_t iterations)
+      : startSignal_(startSignal), ringBuffer_(ringBuffer), iterations_(iterations) {}
+
+  void run() {
+    awaitStart(startSignal_);
+    for (int64_t i = 0; i < iterations_; i++) {
+      const int64_t sequence = ringBuffer_.next();
+      auto &event = ringBuffer_.get(sequence);
+      for (auto &element : event) {
+        element = i;
+      }
+      ringBuffer_.publish(sequence);
+    }
+  }
+
+private:
+  const std::atomic<bool> &startSignal_;
+  RingBufferT &ringBuffer_;
+  const int64_t iterations_;
+};
+
+// 1:1 port of com.lmax.disruptor.support.LongArrayEventHandler
+class LongArrayEventHandler : public disruptor::EventHandler<LongArrayEvent> {
+public:
+  int64_t getValue() const { return value_.load(std::memory_order_acquire); }
+
+  void reset(std::shared_ptr<std::atomic<bool>> latch, int64_t expectedCount) {
+    value_.store(0, std::memory_order_release);
+    latch_ = std::move(latch);
+    count_ = expectedCount;
+  }
+
+  void onEvent(LongArrayEvent &event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    int64_t value = value_.load(std::memory_order_relaxed);
+    for (const int64_t element : event) {
+      value += element;
+    }
+    value_.store(value, std::memory_order_release);
+
+    if (--count_ == 0) {
+      latch_->store(true, std::memory_order_release);
+    }
+  }
+
+private:
+  std::atomic<int64_t> value_{0};
+  int64_t count_{0};
+  std::shared_ptr<std::atomic<bool>> latch_;
+};
+
+} // namespace disruptor::bench::perftest::support
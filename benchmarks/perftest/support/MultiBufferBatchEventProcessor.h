@@ -0,0 +1,83 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.MultiBufferBatchEventProcessor
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/MultiBufferBatchEventProcessor.java
+//
+// A single event processor draining several ring buffers in turn.
+
+#include "disruptor/AlertException.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/Sequence.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace disruptor::bench::perftest::support {
+
+template <typename T, typename DataProviderT, typename BarrierT> class MultiBufferBatchEventProcessor {
+public:
+  MultiBufferBatchEventProcessor(std::vector<DataProviderT *> providers, std::vector<BarrierT *> barriers,
+                                 disruptor::EventHandler<T> &handler)
+      : providers_(std::move(providers)), barriers_(std::move(barriers)), handler_(handler),
+        sequences_(providers_.size()) {
+    if (providers_.size() != barriers_.size()) {
+      throw std::invalid_argument("Should have as many providers as barriers");
+    }
+  }
+
+  void run() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+      throw std::runtime_error("Already running");
+    }
+    for (auto *barrier : barriers_) {
+      barrier->clearAlert();
+    }
+
+    const std::size_t barrierLength = barriers_.size();
+    while (true) {
+      try {
+        for (std::size_t i = 0; i < barrierLength; i++) {
+          const int64_t available = barriers_[i]->waitFor(-1);
+          disruptor::Sequence &sequence = sequences_[i];
+
+          const int64_t nextSequence = sequence.get() + 1;
+          for (int64_t l = nextSequence; l <= available; l++) {
+            handler_.onEvent(providers_[i]->get(l), l, nextSequence == available);
+          }
+
+          sequence.set(available);
+          count_ += available - nextSequence + 1;
+        }
+        std::this_thread::yield();
+      } catch (const disruptor::AlertException &) {
+        if (!isRunning()) {
+          break;
+        }
+      }
+    }
+  }
+
+  disruptor::Sequence &getSequence(std::size_t index) { return sequences_[index]; }
+
+  int64_t getCount() const { return count_; }
+
+  bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+  void halt() {
+    running_.store(false, std::memory_order_release);
+    barriers_[0]->alert();
+  }
+
+private:
+  std::vector<DataProviderT *> providers_;
+  std::vector<BarrierT *> barriers_;
+  disruptor::EventHandler<T> &handler_;
+  std::vector<disruptor::Sequence> sequences_;
+  std::atomic<bool> running_{false};
+  int64_t count_{0};
+};
+
+} // namespace disruptor::bench::perftest::support
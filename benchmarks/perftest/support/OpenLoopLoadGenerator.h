@@ -0,0 +1,170 @@
+#pragma once
+// Open-loop load generation for the latency perftests.
+//
+// Closed-loop producers publish as fast as the ring allows, so a stalled
+// consumer also stalls the measurement ("coordinated omission"). Here every
+// event has an intended send time taken from a schedule, fixed rate or a
+// replayed inter-arrival trace, that does not depend on how the system is
+// doing. The consumer records two latencies:
+//
+//   corrected   = consume time - intended send time  (what a caller would see)
+//   uncorrected = consume time - actual send time    (what closed-loop reports)
+//
+// The difference between the two is the queueing delay a closed-loop
+// benchmark hides.
+
+#include "disruptor/EventFactory.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/util/LatencyHistogram.h"
+#include "disruptor/util/Util.h"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace disruptor::bench::perftest::support {
+
+struct OpenLoopEvent {
+  int64_t intendedNanos{0};
+  int64_t actualNanos{0};
+
+  static std::shared_ptr<disruptor::EventFactory<OpenLoopEvent>> EVENT_FACTORY;
+};
+
+class OpenLoopEventFactory : public disruptor::EventFactory<OpenLoopEvent> {
+public:
+  OpenLoopEvent newInstance() override { return OpenLoopEvent(); }
+};
+
+inline std::shared_ptr<disruptor::EventFactory<OpenLoopEvent>> OpenLoopEvent::EVENT_FACTORY =
+    std::make_shared<OpenLoopEventFactory>();
+
+// Intended send offsets (ns from the start of the run) for each event.
+class ArrivalSchedule {
+public:
+  static ArrivalSchedule fixedRate(double eventsPerSecond, int64_t eventCount) {
+    if (eventsPerSecond <= 0 || eventCount <= 0) {
+      throw std::invalid_argument("fixedRate requires a positive rate and event count");
+    }
+    ArrivalSchedule schedule;
+    schedule.intervalNanos_ = 1e9 / eventsPerSecond;
+    schedule.eventCount_ = eventCount;
+    return schedule;
+  }
+
+  // Replays interArrivalNanos (cycled until eventCount events) with every gap
+  // divided by speedup, so one trace can be swept across rates.
+  static ArrivalSchedule trace(const std::vector<int64_t> &interArrivalNanos, double speedup, int64_t eventCount) {
+    if (interArrivalNanos.empty() || speedup <= 0 || eventCount <= 0) {
+      throw std::invalid_argument("trace requires a non-empty trace, positive speedup and event count");
+    }
+    ArrivalSchedule schedule;
+    schedule.eventCount_ = eventCount;
+    schedule.offsets_.reserve(static_cast<std::size_t>(eventCount));
+    double offset = 0;
+    for (int64_t i = 0; i < eventCount; ++i) {
+      schedule.offsets_.push_back(static_cast<int64_t>(offset));
+      offset += static_cast<double>(interArrivalNanos[static_cast<std::size_t>(i) % interArrivalNanos.size()]) / speedup;
+    }
+    return schedule;
+  }
+
+  int64_t getEventCount() const { return eventCount_; }
+
+  int64_t offsetNanos(int64_t index) const {
+    return offsets_.empty() ? static_cast<int64_t>(static_cast<double>(index) * intervalNanos_)
+                            : offsets_[static_cast<std::size_t>(index)];
+  }
+
+  // Target rate implied by the schedule (events per second).
+  double getTargetRate() const {
+    const int64_t span = offsetNanos(eventCount_ - 1);
+    return span <= 0 ? 0.0 : static_cast<double>(eventCount_ - 1) * 1e9 / static_cast<double>(span);
+  }
+
+private:
+  ArrivalSchedule() = default;
+
+  double intervalNanos_{0};
+  int64_t eventCount_{0};
+  std::vector<int64_t> offsets_;
+};
+
+// One inter-arrival gap in nanoseconds per line; blank lines and lines
+// starting with '#' are ignored.
+inline std::vector<int64_t> loadInterArrivalTrace(const std::string &path) {
+  std::ifstream in(path);
+  if (!in) {
+    throw std::runtime_error("Cannot open inter-arrival trace: " + path);
+  }
+  std::vector<int64_t> gaps;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const int64_t gap = std::stoll(line);
+    if (gap < 0) {
+      throw std::runtime_error("Negative inter-arrival gap in trace: " + path);
+    }
+    gaps.push_back(gap);
+  }
+  return gaps;
+}
+
+class OpenLoopLatencyHandler final : public disruptor::EventHandler<OpenLoopEvent> {
+public:
+  void onEvent(OpenLoopEvent &event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    const int64_t now = disruptor::util::Util::nanoTime();
+    corrected_.record(now - event.intendedNanos);
+    uncorrected_.record(now - event.actualNanos);
+  }
+
+  const disruptor::util::LatencyHistogram &getCorrected() const { return corrected_; }
+  const disruptor::util::LatencyHistogram &getUncorrected() const { return uncorrected_; }
+
+private:
+  disruptor::util::LatencyHistogram corrected_;
+  disruptor::util::LatencyHistogram uncorrected_;
+};
+
+struct OpenLoopResult {
+  double targetRate{0};
+  double achievedRate{0};
+  // Largest amount the publisher fell behind its schedule when it sent.
+  int64_t maxSendLagNanos{0};
+};
+
+// Publishes schedule.getEventCount() events into ringBuffer, sending each at
+// its intended time (or immediately when already late - never skipping).
+template <typename RingBufferT> OpenLoopResult runOpenLoop(RingBufferT &ringBuffer, const ArrivalSchedule &schedule) {
+  OpenLoopResult result;
+  result.targetRate = schedule.getTargetRate();
+
+  const int64_t start = disruptor::util::Util::nanoTime();
+  int64_t actual = start;
+  for (int64_t i = 0; i < schedule.getEventCount(); ++i) {
+    const int64_t intended = start + schedule.offsetNanos(i);
+    while ((actual = disruptor::util::Util::nanoTime()) < intended) {
+      // busy spin until the intended send time
+    }
+    if (actual - intended > result.maxSendLagNanos) {
+      result.maxSendLagNanos = actual - intended;
+    }
+
+    const int64_t sequence = ringBuffer.next();
+    OpenLoopEvent &event = ringBuffer.get(sequence);
+    event.intendedNanos = intended;
+    event.actualNanos = actual;
+    ringBuffer.publish(sequence);
+  }
+
+  const int64_t elapsed = disruptor::util::Util::nanoTime() - start;
+  result.achievedRate = elapsed <= 0 ? 0.0 : static_cast<double>(schedule.getEventCount()) * 1e9 / elapsed;
+  return result;
+}
+
+} // namespace disruptor::bench::perftest::support
@@ -0,0 +1,23 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.Operation
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/Operation.java
+
+#include <cstdint>
+
+namespace disruptor::bench::perftest::support {
+
+enum class Operation { ADDITION, SUBTRACTION, AND };
+
+inline int64_t op(Operation operation, int64_t lhs, int64_t rhs) {
+  switch (operation) {
+  case Operation::ADDITION:
+    return lhs + rhs;
+  case Operation::SUBTRACTION:
+    return lhs - rhs;
+  case Operation::AND:
+    return lhs & rhs;
+  }
+  return lhs;
+}
+
+} // namespace disruptor::bench::perftest::support
@@ -0,0 +1,186 @@
+#pragma once
+// 1:1 ports of the queue-side consumers from com.lmax.disruptor.support:
+// ValueAdditionQueueProcessor, ValueMutationQueueProcessor,
+// FunctionQueueProcessor, FizzBuzzQueueProcessor and ValueQueuePublisher.
+//
+// Java processors loop until interrupted and count down a latch when they
+// reach the expected count; here run() returns once count items have been
+// consumed, so joining the thread is the latch.
+
+#include "BlockingQueue.h"
+#include "Operation.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace disruptor::bench::perftest::support {
+
+class ValueAdditionQueueProcessor {
+public:
+  ValueAdditionQueueProcessor(BlockingQueue<int64_t> &blockingQueue, int64_t count)
+      : blockingQueue_(blockingQueue), count_(count) {}
+
+  int64_t getValue() const { return value_; }
+
+  void reset() { value_ = 0; }
+
+  void run() {
+    for (int64_t i = 0; i < count_; i++) {
+      value_ += blockingQueue_.take();
+    }
+  }
+
+private:
+  BlockingQueue<int64_t> &blockingQueue_;
+  const int64_t count_;
+  int64_t value_{0};
+};
+
+class ValueMutationQueueProcessor {
+public:
+  ValueMutationQueueProcessor(BlockingQueue<int64_t> &blockingQueue, Operation operation, int64_t count)
+      : blockingQueue_(blockingQueue), operation_(operation), count_(count) {}
+
+  int64_t getValue() const { return value_; }
+
+  void reset() { value_ = 0; }
+
+  void run() {
+    for (int64_t i = 0; i < count_; i++) {
+      value_ = op(operation_, value_, blockingQueue_.take());
+    }
+  }
+
+private:
+  BlockingQueue<int64_t> &blockingQueue_;
+  const Operation operation_;
+  const int64_t count_;
+  int64_t value_{0};
+};
+
+// Java: FunctionQueueProcessor(FunctionStep, stepOneQueue, stepTwoQueue, stepThreeQueue, count)
+class FunctionQueueProcessor {
+public:
+  enum class Step { ONE, TWO, THREE };
+
+  FunctionQueueProcessor(Step step, BlockingQueue<std::array<int64_t, 2>> &stepOneQueue,
+                         BlockingQueue<int64_t> &stepTwoQueue, BlockingQueue<int64_t> &stepThreeQueue, int64_t count)
+      : step_(step), stepOneQueue_(stepOneQueue), stepTwoQueue_(stepTwoQueue), stepThreeQueue_(stepThreeQueue),
+        count_(count) {}
+
+  int64_t getStepThreeCounter() const { return stepThreeCounter_; }
+
+  void reset() { stepThreeCounter_ = 0; }
+
+  void run() {
+    for (int64_t i = 0; i < count_; i++) {
+      switch (step_) {
+      case Step::ONE: {
+        const auto values = stepOneQueue_.take();
+        stepTwoQueue_.put(values[0] + values[1]);
+        break;
+      }
+      case Step::TWO:
+        stepThreeQueue_.put(stepTwoQueue_.take() + 3);
+        break;
+      case Step::THREE:
+        if ((stepThreeQueue_.take() & 4L) == 4L) {
+          stepThreeCounter_++;
+        }
+        break;
+      }
+    }
+  }
+
+private:
+  const Step step_;
+  BlockingQueue<std::array<int64_t, 2>> &stepOneQueue_;
+  BlockingQueue<int64_t> &stepTwoQueue_;
+  BlockingQueue<int64_t> &stepThreeQueue_;
+  const int64_t count_;
+  int64_t stepThreeCounter_{0};
+};
+
+// Java: FizzBuzzQueueProcessor(FizzBuzzStep, fizzInputQueue, buzzInputQueue,
+//                              fizzOutputQueue, buzzOutputQueue, count)
+class FizzBuzzQueueProcessor {
+public:
+  enum class Step { FIZZ, BUZZ, FIZZ_BUZZ };
+
+  FizzBuzzQueueProcessor(Step step, BlockingQueue<int64_t> &fizzInputQueue, BlockingQueue<int64_t> &buzzInputQueue,
+                         BlockingQueue<bool> &fizzOutputQueue, BlockingQueue<bool> &buzzOutputQueue, int64_t count)
+      : step_(step), fizzInputQueue_(fizzInputQueue), buzzInputQueue_(buzzInputQueue),
+        fizzOutputQueue_(fizzOutputQueue), buzzOutputQueue_(buzzOutputQueue), count_(count) {}
+
+  int64_t getFizzBuzzCounter() const { return fizzBuzzCounter_; }
+
+  void reset() { fizzBuzzCounter_ = 0; }
+
+  void run() {
+    for (int64_t i = 0; i < count_; i++) {
+      switch (step_) {
+      case Step::FIZZ:
+        fizzOutputQueue_.put(0 == (fizzInputQueue_.take() % 3));
+        break;
+      case Step::BUZZ:
+        buzzOutputQueue_.put(0 == (buzzInputQueue_.take() % 5));
+        break;
+      case Step::FIZZ_BUZZ: {
+        const bool fizz = fizzOutputQueue_.take();
+        const bool buzz = buzzOutputQueue_.take();
+        if (fizz && buzz) {
+          fizzBuzzCounter_++;
+        }
+        break;
+      }
+      }
+    }
+  }
+
+private:
+  const Step step_;
+  BlockingQueue<int64_t> &fizzInputQueue_;
+  BlockingQueue<int64_t> &buzzInputQueue_;
+  BlockingQueue<bool> &fizzOutputQueue_;
+  BlockingQueue<bool> &buzzOutputQueue_;
+  const int64_t count_;
+  int64_t fizzBuzzCounter_{0};
+};
+
+// Java: ValueQueuePublisher(CyclicBarrier, BlockingQueue<Long>, iterations).
+// batchSize > 1 publishes each batch under a single lock acquisition.
+class ValueQueuePublisher {
+public:
+  ValueQueuePublisher(const std::atomic<bool> &startSignal, BlockingQueue<int64_t> &blockingQueue,
+                      int64_t iterations, int batchSize = 1)
+      : startSignal_(startSignal), blockingQueue_(blockingQueue), iterations_(iterations), batchSize_(batchSize) {}
+
+  void run() {
+    while (!startSignal_.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    if (batchSize_ == 1) {
+      for (int64_t i = 0; i < iterations_; i++) {
+        blockingQueue_.put(i);
+      }
+      return;
+    }
+    std::vector<int64_t> batch(static_cast<std::size_t>(batchSize_));
+    for (int64_t i = 0; i < iterations_; i += batchSize_) {
+      std::fill(batch.begin(), batch.end(), i);
+      blockingQueue_.putAll(batch.begin(), batch.end());
+    }
+  }
+
+private:
+  const std::atomic<bool> &startSignal_;
+  BlockingQueue<int64_t> &blockingQueue_;
+  const int64_t iterations_;
+  const int batchSize_;
+};
+
+} // namespace disruptor::bench::perftest::support
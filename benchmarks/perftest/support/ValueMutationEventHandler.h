@@ -0,0 +1,50 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.ValueMutationEventHandler
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/ValueMutationEventHandler.java
+
+#include "disruptor/EventHandler.h"
+#include "Operation.h"
+#include "ValueEvent.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace disruptor::bench::perftest::support {
+
+class ValueMutationEventHandler : public disruptor::EventHandler<ValueEvent> {
+public:
+  explicit ValueMutationEventHandler(Operation operation) : operation_(operation) {}
+
+  int64_t getValue() const { return value_.load(std::memory_order_acquire); }
+
+  int64_t getBatchesProcessed() const { return batchesProcessed_.load(std::memory_order_acquire); }
+
+  void reset(std::shared_ptr<std::atomic<bool>> latch, int64_t expectedCount) {
+    value_.store(0, std::memory_order_release);
+    latch_ = std::move(latch);
+    count_ = expectedCount;
+    batchesProcessed_.store(0, std::memory_order_release);
+  }
+
+  void onEvent(ValueEvent &event, int64_t sequence, bool /*endOfBatch*/) override {
+    value_.store(op(operation_, value_.load(std::memory_order_relaxed), event.getValue()), std::memory_order_release);
+
+    if (count_ == sequence) {
+      latch_->store(true, std::memory_order_release);
+    }
+  }
+
+  void onBatchStart(int64_t /*batchSize*/, int64_t /*queueDepth*/) override {
+    batchesProcessed_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+private:
+  const Operation operation_;
+  std::atomic<int64_t> value_{0};
+  std::atomic<int64_t> batchesProcessed_{0};
+  int64_t count_{0};
+  std::shared_ptr<std::atomic<bool>> latch_;
+};
+
+} // namespace disruptor::bench::perftest::support
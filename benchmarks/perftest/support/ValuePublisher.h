@@ -0,0 +1,65 @@
+#pragma once
+// 1:1 port of com.lmax.disruptor.support.ValuePublisher and ValueBatchPublisher
+// Source: reference/disruptor/src/perftest/java/com/lmax/disruptor/support/ValuePublisher.java
+//
+// Java synchronises publishers with a CyclicBarrier; here every publisher
+// spins on a shared start signal raised by the test thread.
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace disruptor::bench::perftest::support {
+
+inline void awaitStart(const std::atomic<bool> &startSignal) {
+  while (!startSignal.load(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+}
+
+template <typename RingBufferT> class ValuePublisher {
+public:
+  ValuePublisher(const std::atomic<bool> &startSignal, RingBufferT &ringBuffer, int64_t iterations)
+      : startSignal_(startSignal), ringBuffer_(ringBuffer), iterations_(iterations) {}
+
+  void run() {
+    awaitStart(startSignal_);
+    for (int64_t i = 0; i < iterations_; i++) {
+      const int64_t sequence = ringBuffer_.next();
+      ringBuffer_.get(sequence).setValue(i);
+      ringBuffer_.publish(sequence);
+    }
+  }
+
+private:
+  const std::atomic<bool> &startSignal_;
+  RingBufferT &ringBuffer_;
+  const int64_t iterations_;
+};
+
+template <typename RingBufferT> class ValueBatchPublisher {
+public:
+  ValueBatchPublisher(const std::atomic<bool> &startSignal, RingBufferT &ringBuffer, int64_t iterations,
+                      int batchSize)
+      : startSignal_(startSignal), ringBuffer_(ringBuffer), iterations_(iterations), batchSize_(batchSize) {}
+
+  void run() {
+    awaitStart(startSignal_);
+    for (int64_t i = 0; i < iterations_; i += batchSize_) {
+      const int64_t hi = ringBuffer_.next(batchSize_);
+      const int64_t lo = hi - (batchSize_ - 1);
+      for (int64_t l = lo; l <= hi; l++) {
+        ringBuffer_.get(l).setValue(i);
+      }
+      ringBuffer_.publish(lo, hi);
+    }
+  }
+
+private:
+  const std::atomic<bool> &startSignal_;
+  RingBufferT &ringBuffer_;
+  const int64_t iterations_;
+  const int batchSize_;
+};
+
+} // namespace disruptor::bench::perftest::support
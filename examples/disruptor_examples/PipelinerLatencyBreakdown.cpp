@@ -0,0 +1,128 @@
+// Pipeliner-style topology (three parallel stages joined by a fourth)
+// reporting a sampled stage-by-stage latency breakdown with
+// util::SequenceTracer. The ring buffer is built with RingBufferSequenceTracing
+// and the processors with SequenceTracingMetrics, each run on its own thread.
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BatchEventProcessorMetrics.h"
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventFactory.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/RingBufferTracing.h"
+#include "disruptor/util/SequenceTracer.h"
+#include "disruptor/util/ThreadHints.h"
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct PipelinerEvent {
+  int64_t input{0};
+  int64_t result{0};
+
+  struct Factory final : public disruptor::EventFactory<PipelinerEvent> {
+    PipelinerEvent newInstance() override { return PipelinerEvent(); }
+  };
+  static inline std::shared_ptr<disruptor::EventFactory<PipelinerEvent>> FACTORY = std::make_shared<Factory>();
+};
+
+class ParallelHandler final : public disruptor::EventHandler<PipelinerEvent> {
+public:
+  ParallelHandler(int ordinal, int totalHandlers) : ordinal_(ordinal), totalHandlers_(totalHandlers) {}
+
+  void onEvent(PipelinerEvent& event, int64_t sequence, bool /*endOfBatch*/) override {
+    if ((sequence % totalHandlers_) == ordinal_) {
+      event.result = event.input * 2;
+    }
+  }
+
+private:
+  int ordinal_;
+  int totalHandlers_;
+};
+
+class JoiningHandler final : public disruptor::EventHandler<PipelinerEvent> {
+public:
+  void onEvent(PipelinerEvent& event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    errors_ += event.result == event.input * 2 ? 0 : 1;
+  }
+
+  int errors() const { return errors_; }
+
+private:
+  int errors_{0};
+};
+
+void printSegment(const char* name, const disruptor::util::LatencyHistogram& h) {
+  std::cout << name << ": p50=" << h.getValueAtPercentile(50.0) << "ns p99=" << h.getValueAtPercentile(99.0)
+            << "ns max=" << h.getMax() << "ns\n";
+}
+
+} // namespace
+
+int main() {
+  using WS = disruptor::BlockingWaitStrategy;
+  using RB = disruptor::SingleProducerRingBuffer<PipelinerEvent, WS, disruptor::RingBufferSequenceTracing>;
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(PipelinerEvent::FACTORY, 1024, ws);
+  auto& rb = *ringBuffer;
+
+  // Stages: 0 = parallel handlers (any of the three), 1 = joining handler.
+  // The parallel stage column is stamped by whichever handler finishes last.
+  disruptor::util::SequenceTracer tracer(1024, 16, 2);
+  rb.getTracing().attach(tracer);
+
+  ParallelHandler h0(0, 3);
+  ParallelHandler h1(1, 3);
+  ParallelHandler h2(2, 3);
+  JoiningHandler join;
+
+  disruptor::BatchEventProcessorBuilder builder;
+  auto parallelBarrier = rb.newBarrier(nullptr, 0);
+  auto p0 = builder.build<disruptor::SequenceTracingMetrics>(rb, *parallelBarrier, h0);
+  auto p1 = builder.build<disruptor::SequenceTracingMetrics>(rb, *parallelBarrier, h1);
+  auto p2 = builder.build<disruptor::SequenceTracingMetrics>(rb, *parallelBarrier, h2);
+  p0->getMetrics().attach(tracer, 0);
+  p1->getMetrics().attach(tracer, 0);
+  p2->getMetrics().attach(tracer, 0);
+
+  disruptor::Sequence* parallelSequences[] = {&p0->getSequence(), &p1->getSequence(), &p2->getSequence()};
+  auto joinBarrier = rb.newBarrier(parallelSequences, 3);
+  auto pj = builder.build<disruptor::SequenceTracingMetrics>(rb, *joinBarrier, join);
+  pj->getMetrics().attach(tracer, 1);
+
+  rb.addGatingSequences(pj->getSequence());
+
+  disruptor::EventProcessor* processors[] = {p0.get(), p1.get(), p2.get(), pj.get()};
+  std::vector<std::thread> threads;
+  for (auto* processor : processors) {
+    threads.emplace_back([processor] { processor->run(); });
+  }
+
+  for (int i = 0; i < 100000; ++i) {
+    int64_t next = rb.next();
+    rb.get(next).input = i;
+    rb.publish(next);
+  }
+  while (pj->getSequence().get() < rb.getCursor()) {
+    disruptor::util::ThreadHints::onSpinWait();
+  }
+  for (auto* processor : processors) {
+    processor->halt();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto report = tracer.report();
+  std::cout << "samples: " << report.getSampleCount() << "\n";
+  printSegment("claim -> publish", report.getSegment(0));
+  printSegment("publish -> parallel", report.getSegment(1));
+  printSegment("parallel -> join", report.getSegment(2));
+  printSegment("end to end", report.getEndToEnd());
+  return join.errors() == 0 ? 0 : 1;
+}
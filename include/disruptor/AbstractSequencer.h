@@ -12,6 +12,7 @@
 #include "SequenceGroups.h"
 #include "util/Util.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
@@ -74,15 +75,32 @@ public:
            "waitStrategy=" + "..., cursor=..., gatingSequences=...}";
   }
 
+  // Producer backpressure counters (not in the Java reference): how many
+  // claims had to wait for consumers to free a slot, and for how long. Only
+  // updated on the wrap-wait slow path; safe to read from any thread.
+  uint64_t getWrapWaitCount() const {
+    return wrapWaitCount_.load(std::memory_order_relaxed);
+  }
+  int64_t getWrapWaitNanos() const {
+    return wrapWaitNanos_.load(std::memory_order_relaxed);
+  }
+
   // Public accessor for waitStrategy (needed for WaitSpinningHelper, matches Java reflection access)
   WaitStrategyT &getWaitStrategy() { return *waitStrategy_; }
   const WaitStrategyT &getWaitStrategy() const { return *waitStrategy_; }
 
 protected:
+  void recordWrapWait(int64_t waitedNanos) {
+    wrapWaitCount_.fetch_add(1, std::memory_order_relaxed);
+    wrapWaitNanos_.fetch_add(waitedNanos, std::memory_order_relaxed);
+  }
+
   int bufferSize_;
   WaitStrategyT *waitStrategy_;
   Sequence cursor_;
   std::atomic<std::shared_ptr<std::vector<Sequence *>>> gatingSequences_;
+  std::atomic<uint64_t> wrapWaitCount_{0};
+  std::atomic<int64_t> wrapWaitNanos_{0};
 };
 
 } // namespace disruptor
@@ -0,0 +1,124 @@
+#pragma once
+// Awaitable view of a ProcessingSequenceBarrier.
+//
+//   ConsumerTask consume(AsyncSequenceBarrier<RingBufferT>& barrier, Sequence& sequence) {
+//     int64_t next = sequence.get() + 1;
+//     while (true) {
+//       const int64_t available = co_await barrier.nextBatch(next);
+//       for (; next <= available; ++next) { handle(barrier.get(next)); }
+//       sequence.set(available);
+//     }
+//   }
+//
+// nextBatch() completes with the highest available sequence (>= next), the
+// same value BatchEventProcessor gets from waitFor(). If the batch is not yet
+// published the coroutine is suspended and handed to the CoroutineExecutor,
+// which resumes it after a publish wakes the ring's EpochWaitStrategy.
+// alert() ends the consumer: the pending or next nextBatch() throws
+// AlertException.
+//
+// The consumer's sequence must be added as a gating sequence of the ring.
+
+#include "AlertException.h"
+#include "CoroutineExecutor.h"
+#include "EpochWaitStrategy.h"
+#include "Sequence.h"
+
+#include <coroutine>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace disruptor {
+
+template <typename RingBufferT>
+class AsyncSequenceBarrier final {
+public:
+  using BarrierPtr = decltype(std::declval<RingBufferT&>().newBarrier());
+
+  class Awaiter final : private CoroutineExecutor::Waiter {
+  public:
+    bool await_ready() {
+      ready_ = poll();
+      return ready_ && owner_->executor_->takeInlineBudget();
+    }
+
+    void await_suspend(ConsumerTask::Handle suspended) {
+      handle = suspended;
+      if (ready_) {
+        owner_->executor_->yield(suspended);
+      } else {
+        owner_->executor_->wait(*this);
+      }
+    }
+
+    int64_t await_resume() {
+      if (alerted_) {
+        throw AlertException::INSTANCE();
+      }
+      return available_;
+    }
+
+  private:
+    friend class AsyncSequenceBarrier;
+
+    Awaiter(AsyncSequenceBarrier& owner, int64_t sequence) : owner_(&owner), sequence_(sequence) {}
+
+    bool poll() override {
+      try {
+        available_ = owner_->barrier_->tryWaitFor(sequence_);
+      } catch (const AlertException&) {
+        alerted_ = true;
+        return true;
+      }
+      return available_ >= sequence_;
+    }
+
+    AsyncSequenceBarrier* owner_;
+    int64_t sequence_;
+    int64_t available_ = -1;
+    bool ready_ = false;
+    bool alerted_ = false;
+  };
+
+  // dependentSequences as for RingBuffer::newBarrier(); none means the cursor.
+  AsyncSequenceBarrier(CoroutineExecutor& executor,
+                       RingBufferT& ringBuffer,
+                       Sequence* const* dependentSequences = nullptr,
+                       int dependentCount = 0)
+      : executor_(&executor),
+        ringBuffer_(&ringBuffer),
+        barrier_(ringBuffer.newBarrier(dependentSequences, dependentCount)) {
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(ringBuffer.getSequencer().getWaitStrategy())>,
+                                 EpochWaitStrategy>,
+                  "AsyncSequenceBarrier rings must use EpochWaitStrategy");
+    if (&ringBuffer.getSequencer().getWaitStrategy() != &executor.getWaitStrategy()) {
+      throw std::invalid_argument("Ring buffer does not share the executor's EpochWaitStrategy");
+    }
+  }
+
+  AsyncSequenceBarrier(const AsyncSequenceBarrier&) = delete;
+  AsyncSequenceBarrier& operator=(const AsyncSequenceBarrier&) = delete;
+
+  // Must be awaited from a ConsumerTask running on this barrier's executor.
+  Awaiter nextBatch(int64_t sequence) { return Awaiter(*this, sequence); }
+
+  auto& get(int64_t sequence) { return ringBuffer_->get(sequence); }
+
+  int64_t getCursor() const { return barrier_->getCursor(); }
+
+  void alert() { barrier_->alert(); }
+
+  void clearAlert() { barrier_->clearAlert(); }
+
+  bool isAlerted() const { return barrier_->isAlerted(); }
+
+private:
+  CoroutineExecutor* executor_;
+  RingBufferT* ringBuffer_;
+  BarrierPtr barrier_;
+};
+
+} // namespace disruptor
@@ -3,6 +3,7 @@
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/BatchEventProcessor.java
 
 #include "AlertException.h"
+#include "BatchEventProcessorMetrics.h"
 #include "BatchRewindStrategy.h"
 #include "DataProvider.h"
 #include "EventHandlerBase.h"
@@ -22,10 +23,12 @@
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 namespace disruptor {
 
-template <typename T, typename BarrierT>
+// MetricsT: optional instrumentation policy (see BatchEventProcessorMetrics.h).
+template <typename T, typename BarrierT, typename MetricsT = NoOpBatchEventProcessorMetrics>
 class BatchEventProcessor final : public EventProcessor {
 public:
   BatchEventProcessor(DataProvider<T>& dataProvider,
@@ -62,6 +65,15 @@ public:
 
   bool isRunning() override { return running_.load(std::memory_order_acquire) != IDLE; }
 
+  // Events skipped because the producer overwrote them before they were
+  // handled (only with an OverwritingSequencerType sequencer; otherwise 0).
+  int64_t getDroppedCount() const { return droppedCount_.load(std::memory_order_relaxed); }
+
+  // Safe to read from any thread while the processor is running.
+  const MetricsT& getMetrics() const { return metrics_; }
+  // Configure the policy (e.g. SequenceTracingMetrics::attach) before run().
+  MetricsT& getMetrics() { return metrics_; }
+
   void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) {
     exceptionHandler_ = &exceptionHandler;
     if (exceptionHandler_ == nullptr) {
@@ -98,6 +110,14 @@ private:
   static constexpr int IDLE = 0;
   static constexpr int HALTED = IDLE + 1;
   static constexpr int RUNNING = HALTED + 1;
+  static constexpr bool kCanBeOverwritten = requires(BarrierT& barrier, int64_t sequence) {
+    barrier.isIntact(sequence);
+    barrier.getOldestIntactSequence();
+  };
+  // An overwritten slot may be rewritten while it is read, so events are
+  // copied out and re-checked; that copy is only safe for trivial types.
+  static_assert(!kCanBeOverwritten || std::is_trivially_copyable_v<T>,
+                "events on an overwriting ring must be trivially copyable");
 
   std::atomic<int> running_;
   ExceptionHandler<T>* exceptionHandler_;
@@ -108,34 +128,69 @@ private:
   Sequence sequence_;
   std::unique_ptr<RewindHandler> rewindHandler_;
   int retriesAttempted_;
+  [[no_unique_address]] MetricsT metrics_;
+  std::atomic<int64_t> droppedCount_{0};
 
   void processEvents() {
     T* event = nullptr;
     int64_t nextSequence = sequence_.get() + 1;
+    // A wait spans every waitFor until a batch arrives, so the timer is not
+    // restarted when waitFor returns short.
+    [[maybe_unused]] bool waiting = false;
 
     while (true) {
       const int64_t startOfBatchSequence = nextSequence;
       try {
         try {
+          if constexpr (MetricsT::kEnabled) {
+            if (!waiting) {
+              metrics_.onWaitStart();
+              waiting = true;
+            }
+          }
           const int64_t availableSequence = sequenceBarrier_->waitFor(nextSequence);
+          if constexpr (kCanBeOverwritten) {
+            nextSequence = skipOverwritten(nextSequence);
+          }
           if (availableSequence < nextSequence) {
             // Java: if insufficient available, continue waiting without moving the processor sequence backwards.
             continue;
           }
           const int64_t endOfBatchSequence = std::min(nextSequence + batchLimitOffset_, availableSequence);
 
+          if constexpr (MetricsT::kEnabled) {
+            metrics_.onWaitEnd();
+            waiting = false;
+            metrics_.onBatch(endOfBatchSequence - nextSequence + 1);
+          }
+
           if (nextSequence <= endOfBatchSequence) {
             eventHandler_->onBatchStart(endOfBatchSequence - nextSequence + 1, availableSequence - nextSequence + 1);
           }
 
           while (nextSequence <= endOfBatchSequence) {
             event = &dataProvider_->get(nextSequence);
-            eventHandler_->onEvent(*event, nextSequence, nextSequence == endOfBatchSequence);
+            if constexpr (kCanBeOverwritten) {
+              if (!handleIfIntact(*event, nextSequence, nextSequence == endOfBatchSequence)) {
+                // Lapped mid-batch: everything up to here is gone too.
+                nextSequence = skipOverwritten(nextSequence + 1, 1);
+                break;
+              }
+            } else {
+              eventHandler_->onEvent(*event, nextSequence, nextSequence == endOfBatchSequence);
+            }
+            if constexpr (MetricsT::kEnabled) {
+              metrics_.onEvent(*event, nextSequence);
+            }
             ++nextSequence;
           }
 
           retriesAttempted_ = 0;
-          sequence_.set(endOfBatchSequence);
+          if constexpr (kCanBeOverwritten) {
+            sequence_.set(nextSequence - 1);
+          } else {
+            sequence_.set(endOfBatchSequence);
+          }
         } catch (const RewindableException& e) {
           nextSequence = rewindHandler_->attemptRewindGetNextSequence(e, startOfBatchSequence);
         }
@@ -153,6 +208,33 @@ private:
     }
   }
 
+  // Moves nextSequence past slots the producer has already reclaimed,
+  // counting them (plus alreadyDropped) as dropped.
+  int64_t skipOverwritten(int64_t nextSequence, int64_t alreadyDropped = 0) {
+    const int64_t oldest = sequenceBarrier_->getOldestIntactSequence();
+    const int64_t skipped = oldest > nextSequence ? oldest - nextSequence : 0;
+    if (skipped + alreadyDropped > 0) {
+      droppedCount_.fetch_add(skipped + alreadyDropped, std::memory_order_relaxed);
+      sequence_.set(nextSequence + skipped - 1);
+    }
+    return nextSequence + skipped;
+  }
+
+  // Seqlock read: the event is copied, then handed to the handler only if
+  // its slot still held it throughout the copy.
+  bool handleIfIntact(T& event, int64_t sequence, bool endOfBatch) {
+    if (!sequenceBarrier_->isIntact(sequence)) {
+      return false;
+    }
+    T copy(event);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!sequenceBarrier_->isIntact(sequence)) {
+      return false;
+    }
+    eventHandler_->onEvent(copy, sequence, endOfBatch);
+    return true;
+  }
+
   void earlyExit() {
     notifyStart();
     notifyShutdown();
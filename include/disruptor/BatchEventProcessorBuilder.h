@@ -50,6 +50,32 @@ public:
                                                     &batchRewindStrategy);
   }
 
+  // Instrumented variants: builder.build<BatchEventProcessorMetrics>(...)
+  template <typename MetricsT, typename T, typename BarrierT>
+  std::shared_ptr<BatchEventProcessor<T, BarrierT, MetricsT>> build(DataProvider<T>& dataProvider,
+                                                                    BarrierT& sequenceBarrier,
+                                                                    EventHandler<T>& eventHandler) {
+    auto processor = std::make_shared<BatchEventProcessor<T, BarrierT, MetricsT>>(dataProvider,
+                                                                        sequenceBarrier,
+                                                                        eventHandler,
+                                                                        maxBatchSize_,
+                                                                        nullptr);
+    eventHandler.setSequenceCallback(processor->getSequence());
+    return processor;
+  }
+
+  template <typename MetricsT, typename T, typename BarrierT>
+  std::shared_ptr<BatchEventProcessor<T, BarrierT, MetricsT>> build(DataProvider<T>& dataProvider,
+                                                                    BarrierT& sequenceBarrier,
+                                                                    RewindableEventHandler<T>& rewindableEventHandler,
+                                                                    BatchRewindStrategy& batchRewindStrategy) {
+    return std::make_shared<BatchEventProcessor<T, BarrierT, MetricsT>>(dataProvider,
+                                                              sequenceBarrier,
+                                                              rewindableEventHandler,
+                                                              maxBatchSize_,
+                                                              &batchRewindStrategy);
+  }
+
 private:
   int maxBatchSize_ = std::numeric_limits<int>::max();
 };
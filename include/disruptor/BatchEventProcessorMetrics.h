@@ -0,0 +1,117 @@
+#pragma once
+// Opt-in instrumentation policies for BatchEventProcessor.
+//
+// BatchEventProcessor takes the policy as a template parameter and only calls
+// into it under `if constexpr (MetricsT::kEnabled)`, so the default
+// NoOpBatchEventProcessorMetrics compiles to nothing.
+//
+// Required API for a metrics policy `M`:
+//   static constexpr bool M::kEnabled;
+//   void M::onWaitStart();
+//   void M::onWaitEnd();                        // waitFor returned a batch
+//   void M::onBatch(int64_t batchSize);
+//   template <typename E> void M::onEvent(const E& event, int64_t sequence);  // after the handler
+
+#include "util/LatencyHistogram.h"
+#include "util/SequenceTracer.h"
+#include "util/Util.h"
+
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+
+namespace disruptor {
+
+// Events that carry the time they were published (stored by the translator
+// using util::Util::nanoTime(); zero means "not stamped").
+template <typename E>
+concept PublishTimestamped = requires(const E& event) {
+  { event.getPublishTimestamp() } -> std::convertible_to<int64_t>;
+};
+
+struct NoOpBatchEventProcessorMetrics final {
+  static constexpr bool kEnabled = false;
+
+  void onWaitStart() noexcept {}
+  void onWaitEnd() noexcept {}
+  void onBatch(int64_t /*batchSize*/) noexcept {}
+  template <typename E>
+  void onEvent(const E& /*event*/, int64_t /*sequence*/) noexcept {}
+};
+
+// Per-processor histograms of batch size, time spent in waitFor, and
+// publish-to-consume latency. Written only by the processor thread; the
+// histograms can be read from any thread while the processor is running.
+//
+// The clock is read twice per batch (around waitFor); publish-to-consume
+// latency is measured against the time the batch became available, so it
+// reports queueing delay rather than handler time.
+class BatchEventProcessorMetrics final {
+public:
+  static constexpr bool kEnabled = true;
+
+  void onWaitStart() noexcept { waitStartNanos_ = util::Util::nanoTime(); }
+
+  void onWaitEnd() noexcept {
+    batchStartNanos_ = util::Util::nanoTime();
+    waitDurations_.record(batchStartNanos_ - waitStartNanos_);
+  }
+
+  void onBatch(int64_t batchSize) noexcept { batchSizes_.record(batchSize); }
+
+  template <typename E>
+  void onEvent(const E& event, int64_t /*sequence*/) noexcept {
+    if constexpr (PublishTimestamped<E>) {
+      const int64_t publishedAt = static_cast<int64_t>(event.getPublishTimestamp());
+      if (publishedAt != 0) {
+        publishToConsumeLatencies_.record(batchStartNanos_ - publishedAt);
+      }
+    }
+  }
+
+  const util::LatencyHistogram& getBatchSizes() const noexcept { return batchSizes_; }
+  const util::LatencyHistogram& getWaitDurations() const noexcept { return waitDurations_; }
+  const util::LatencyHistogram& getPublishToConsumeLatencies() const noexcept {
+    return publishToConsumeLatencies_;
+  }
+
+private:
+  int64_t waitStartNanos_ = 0;
+  int64_t batchStartNanos_ = 0;
+  util::LatencyHistogram batchSizes_;
+  util::LatencyHistogram waitDurations_;
+  util::LatencyHistogram publishToConsumeLatencies_;
+};
+
+// Stamps the processor's stage column in a util::SequenceTracer for sampled
+// sequences. Attach before the processor starts:
+//   processor->getMetrics().attach(tracer, stage);
+class SequenceTracingMetrics final {
+public:
+  static constexpr bool kEnabled = true;
+
+  void attach(util::SequenceTracer& tracer, int stage) {
+    if (stage < 0 || stage >= tracer.getStageCount()) {
+      throw std::invalid_argument("stage must be within the tracer's stage count");
+    }
+    tracer_ = &tracer;
+    stage_ = stage;
+  }
+
+  void onWaitStart() noexcept {}
+  void onWaitEnd() noexcept {}
+  void onBatch(int64_t /*batchSize*/) noexcept {}
+
+  template <typename E>
+  void onEvent(const E& /*event*/, int64_t sequence) noexcept {
+    if (tracer_ != nullptr) {
+      tracer_->onStage(stage_, sequence);
+    }
+  }
+
+private:
+  util::SequenceTracer* tracer_ = nullptr;
+  int stage_ = 0;
+};
+
+} // namespace disruptor
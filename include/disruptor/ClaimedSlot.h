@@ -0,0 +1,129 @@
+#pragma once
+// Scoped claims for writing events in place.
+//
+//   {
+//     auto slot = ringBuffer->claim();          // next()
+//     slot->price = ...;                        // write straight into the ring
+//   }                                           // publish(sequence)
+//
+// ClaimedSlot and ClaimedRange publish what they claimed when they go out of
+// scope, including when the scope is left by an exception. A claimed but
+// never published sequence would stall every consumer behind it, so a
+// partially written event is still published; event types that can be left
+// half-written should carry their own "valid" field and set it last.
+// publish() publishes early; the destructor then does nothing.
+//
+// Both are move-only and must not outlive the ring buffer.
+
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace disruptor {
+
+template <typename RingBufferT>
+class ClaimedSlot final {
+public:
+  using EventType = typename RingBufferT::EventType;
+
+  // Adopts a sequence already claimed from ringBuffer (see RingBuffer::claim()).
+  ClaimedSlot(RingBufferT& ringBuffer, int64_t sequence) : ringBuffer_(&ringBuffer), sequence_(sequence) {}
+
+  ClaimedSlot(ClaimedSlot&& other) noexcept
+      : ringBuffer_(std::exchange(other.ringBuffer_, nullptr)), sequence_(other.sequence_) {}
+
+  ClaimedSlot& operator=(ClaimedSlot&& other) noexcept {
+    if (this != &other) {
+      publish();
+      ringBuffer_ = std::exchange(other.ringBuffer_, nullptr);
+      sequence_ = other.sequence_;
+    }
+    return *this;
+  }
+
+  ClaimedSlot(const ClaimedSlot&) = delete;
+  ClaimedSlot& operator=(const ClaimedSlot&) = delete;
+
+  ~ClaimedSlot() { publish(); }
+
+  EventType& get() const { return ringBuffer_->get(sequence_); }
+  EventType& operator*() const { return get(); }
+  EventType* operator->() const { return &get(); }
+
+  int64_t getSequence() const { return sequence_; }
+
+  // false once published (or moved from).
+  bool isPending() const { return ringBuffer_ != nullptr; }
+
+  void publish() noexcept {
+    if (ringBuffer_ != nullptr) {
+      std::exchange(ringBuffer_, nullptr)->publish(sequence_);
+    }
+  }
+
+private:
+  RingBufferT* ringBuffer_;
+  int64_t sequence_;
+};
+
+template <typename RingBufferT>
+class ClaimedRange final {
+public:
+  using EventType = typename RingBufferT::EventType;
+
+  // Adopts sequences lo..hi already claimed from ringBuffer (see RingBuffer::claim(n)).
+  ClaimedRange(RingBufferT& ringBuffer, int64_t lo, int64_t hi) : ringBuffer_(&ringBuffer), lo_(lo), hi_(hi) {}
+
+  ClaimedRange(ClaimedRange&& other) noexcept
+      : ringBuffer_(std::exchange(other.ringBuffer_, nullptr)), lo_(other.lo_), hi_(other.hi_) {}
+
+  ClaimedRange& operator=(ClaimedRange&& other) noexcept {
+    if (this != &other) {
+      publish();
+      ringBuffer_ = std::exchange(other.ringBuffer_, nullptr);
+      lo_ = other.lo_;
+      hi_ = other.hi_;
+    }
+    return *this;
+  }
+
+  ClaimedRange(const ClaimedRange&) = delete;
+  ClaimedRange& operator=(const ClaimedRange&) = delete;
+
+  ~ClaimedRange() { publish(); }
+
+  int size() const { return static_cast<int>(hi_ - lo_ + 1); }
+  int64_t getLowSequence() const { return lo_; }
+  int64_t getHighSequence() const { return hi_; }
+
+  // The event at getLowSequence() + index.
+  EventType& operator[](int index) const { return ringBuffer_->get(lo_ + index); }
+
+  // The claimed slots as contiguous storage: the first span runs up to the
+  // end of the ring, the second (empty unless the claim wraps) from its start.
+  std::pair<std::span<EventType>, std::span<EventType>> spans() const {
+    const int bufferSize = ringBuffer_->getBufferSize();
+    const int firstIndex = static_cast<int>(lo_ & (bufferSize - 1));
+    const int firstSize = size() < bufferSize - firstIndex ? size() : bufferSize - firstIndex;
+    std::span<EventType> first(&ringBuffer_->get(lo_), static_cast<size_t>(firstSize));
+    if (firstSize == size()) {
+      return {first, {}};
+    }
+    return {first, std::span<EventType>(&ringBuffer_->get(lo_ + firstSize), static_cast<size_t>(size() - firstSize))};
+  }
+
+  bool isPending() const { return ringBuffer_ != nullptr; }
+
+  void publish() noexcept {
+    if (ringBuffer_ != nullptr) {
+      std::exchange(ringBuffer_, nullptr)->publish(lo_, hi_);
+    }
+  }
+
+private:
+  RingBufferT* ringBuffer_;
+  int64_t lo_;
+  int64_t hi_;
+};
+
+} // namespace disruptor
@@ -0,0 +1,172 @@
+#pragma once
+// Queue that conflates updates by key: a consumer sees each pending key once,
+// with its latest value. It is the DataProvider for its "updated keys" ring,
+// so exactly one consumer may read it, once per sequence. Keys are never
+// removed; update() throws once keyCapacity keys are in use.
+
+#include "DataProvider.h"
+#include "EventFactory.h"
+#include "RingBuffer.h"
+#include "util/ThreadHints.h"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace disruptor {
+
+// The event a ConflatingQueue consumer sees: a key and its latest value.
+template <typename K, typename V>
+struct ConflatedEntry {
+  K key{};
+  V value{};
+  // Index of the key in the queue's table (set by the producer).
+  uint32_t slot = 0;
+};
+
+// SequencerT is the keys ring's sequencer; use MultiProducerSequencer when
+// several threads call update().
+template <typename K, typename V, typename SequencerT, typename Hash = std::hash<K>>
+class ConflatingQueue final : public DataProvider<ConflatedEntry<K, V>> {
+public:
+  using EntryType = ConflatedEntry<K, V>;
+  using RingBufferT = RingBuffer<EntryType, SequencerT>;
+
+  // keyCapacity must be a power of 2; the keys ring gets twice as many slots
+  // so that consumer batches in flight do not stall producers.
+  template <typename WaitStrategyT>
+  ConflatingQueue(int keyCapacity, WaitStrategyT &waitStrategy, Hash hash = Hash())
+      : keyCapacity_(checkCapacity(keyCapacity)),
+        mask_(static_cast<size_t>(keyCapacity) - 1),
+        slots_(std::make_unique<KeySlot[]>(static_cast<size_t>(keyCapacity))),
+        hash_(std::move(hash)),
+        ringBuffer_(new RingBufferT(std::make_shared<EntryFactory>(), std::in_place, keyCapacity * 2,
+                                    waitStrategy)) {}
+
+  ConflatingQueue(const ConflatingQueue &) = delete;
+  ConflatingQueue &operator=(const ConflatingQueue &) = delete;
+
+  // Replaces the key's value.
+  void update(const K &key, const V &value) {
+    update(key, [&value](V &latest) { latest = value; });
+  }
+
+  // Calls updater(V &latest) on the key's current value (default-constructed
+  // for a new key), e.g. to merge a partial update.
+  template <typename F>
+    requires std::invocable<F &, V &>
+  void update(const K &key, F &&updater) {
+    const uint32_t index = indexFor(key);
+    KeySlot &slot = slots_[index];
+    bool wasPending;
+    {
+      SlotLock lock(slot);
+      updater(slot.value);
+      wasPending = slot.pending;
+      slot.pending = true;
+    }
+    if (wasPending) {
+      conflatedCount_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    const int64_t sequence = ringBuffer_->next();
+    ringBuffer_->get(sequence).slot = index;
+    ringBuffer_->publish(sequence);
+  }
+
+  // DataProvider: the entry for sequence, filled with its key's latest value.
+  EntryType &get(int64_t sequence) override {
+    EntryType &entry = ringBuffer_->get(sequence);
+    KeySlot &slot = slots_[entry.slot];
+    SlotLock lock(slot);
+    entry.key = slot.key;
+    entry.value = slot.value;
+    slot.pending = false;
+    return entry;
+  }
+
+  // The "updated keys" ring: barriers and gating sequences come from here.
+  RingBufferT &getRingBuffer() { return *ringBuffer_; }
+
+  int getKeyCapacity() const { return keyCapacity_; }
+
+  // Updates absorbed into an already pending key.
+  int64_t getConflatedCount() const { return conflatedCount_.load(std::memory_order_relaxed); }
+
+private:
+  static constexpr uint32_t kEmpty = 0;
+  static constexpr uint32_t kInserting = 1;
+  static constexpr uint32_t kReady = 2;
+
+  struct alignas(64) KeySlot {
+    std::atomic<uint32_t> state{kEmpty};
+    std::atomic<bool> locked{false};
+    bool pending = false;
+    K key{};
+    V value{};
+  };
+
+  class SlotLock {
+  public:
+    explicit SlotLock(KeySlot &slot) : slot_(&slot) {
+      while (slot_->locked.exchange(true, std::memory_order_acquire)) {
+        util::ThreadHints::onSpinWait();
+      }
+    }
+    ~SlotLock() { slot_->locked.store(false, std::memory_order_release); }
+    SlotLock(const SlotLock &) = delete;
+    SlotLock &operator=(const SlotLock &) = delete;
+
+  private:
+    KeySlot* slot_;
+  };
+
+  class EntryFactory final : public EventFactory<EntryType> {
+  public:
+    EntryType newInstance() override { return EntryType{}; }
+  };
+
+  int keyCapacity_;
+  size_t mask_;
+  std::unique_ptr<KeySlot[]> slots_;
+  [[no_unique_address]] Hash hash_;
+  std::unique_ptr<RingBufferT> ringBuffer_;
+  std::atomic<int64_t> conflatedCount_{0};
+
+  static int checkCapacity(int keyCapacity) {
+    if (keyCapacity < 1 || (keyCapacity & (keyCapacity - 1)) != 0) {
+      throw std::invalid_argument("keyCapacity must be a power of 2");
+    }
+    return keyCapacity;
+  }
+
+  // Finds the key's slot, claiming an empty one (linear probing) if needed.
+  uint32_t indexFor(const K &key) {
+    size_t index = hash_(key) & mask_;
+    for (int probes = 0; probes < keyCapacity_; ++probes, index = (index + 1) & mask_) {
+      KeySlot &slot = slots_[index];
+      uint32_t state = slot.state.load(std::memory_order_acquire);
+      if (state == kEmpty &&
+          slot.state.compare_exchange_strong(state, kInserting, std::memory_order_acq_rel)) {
+        slot.key = key;
+        slot.state.store(kReady, std::memory_order_release);
+        return static_cast<uint32_t>(index);
+      }
+      while (state == kInserting) {
+        util::ThreadHints::onSpinWait();
+        state = slot.state.load(std::memory_order_acquire);
+      }
+      if (slot.key == key) {
+        return static_cast<uint32_t>(index);
+      }
+    }
+    throw std::runtime_error("ConflatingQueue key table is full");
+  }
+};
+
+} // namespace disruptor
@@ -0,0 +1,287 @@
+#pragma once
+// Runs many coroutine consumers on one thread.
+//
+// A consumer is a ConsumerTask coroutine that loops on
+// `co_await barrier.nextBatch(next)` (see AsyncSequenceBarrier). Instead of
+// blocking a thread per consumer the way BatchEventProcessor does, a
+// coroutine whose sequence is not yet published is suspended and parked in
+// the executor's wait list. run() resumes the ones whose barrier has moved,
+// and once nothing is runnable it parks on the shared EpochWaitStrategy until
+// a publish (or alert) on any ring signals it. Thousands of mostly-idle
+// consumers, e.g. one pipeline per session, can share a single thread; use
+// several executors for several threads.
+//
+// Every ring serviced by the executor must be created with its
+// EpochWaitStrategy instance, otherwise its publishes would not wake run().
+// A consumer ends when its barrier is alerted (the AlertException thrown out
+// of nextBatch() is swallowed). Any other exception escaping a consumer is
+// rethrown from run() after the coroutine is destroyed.
+
+#include "AlertException.h"
+#include "EpochWaitStrategy.h"
+#include "util/ThreadHints.h"
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+// Return type of a consumer coroutine. The coroutine starts suspended and
+// only runs once handed to CoroutineExecutor::spawn().
+class ConsumerTask final {
+public:
+  struct promise_type {
+    ConsumerTask get_return_object() {
+      return ConsumerTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() {
+      try {
+        throw;
+      } catch (const AlertException&) {
+        // Barrier alerted: a normal way for a consumer to finish.
+      } catch (...) {
+        exception = std::current_exception();
+      }
+    }
+
+    std::exception_ptr exception;
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  ConsumerTask(ConsumerTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+  ConsumerTask& operator=(ConsumerTask&& other) noexcept {
+    if (this != &other) {
+      reset();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  ConsumerTask(const ConsumerTask&) = delete;
+  ConsumerTask& operator=(const ConsumerTask&) = delete;
+
+  ~ConsumerTask() { reset(); }
+
+  Handle release() { return std::exchange(handle_, nullptr); }
+
+private:
+  explicit ConsumerTask(Handle handle) : handle_(handle) {}
+
+  void reset() {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = nullptr;
+    }
+  }
+
+  Handle handle_;
+};
+
+class CoroutineExecutor final {
+public:
+  // A suspended awaiter; it stays in the coroutine frame while parked here.
+  class Waiter {
+  public:
+    // true once the awaited sequence is available or the barrier is alerted.
+    virtual bool poll() = 0;
+
+    ConsumerTask::Handle handle;
+
+  protected:
+    ~Waiter() = default;
+  };
+
+  // A consumer that keeps finding its batch ready is resumed inline at most
+  // this many times before it is requeued behind the other consumers.
+  static constexpr int kMaxInlineBatches = 16;
+
+  explicit CoroutineExecutor(EpochWaitStrategy& waitStrategy, int idleSpins = 100)
+      : running_(IDLE), waitStrategy_(&waitStrategy), idleSpins_(idleSpins) {}
+
+  CoroutineExecutor(const CoroutineExecutor&) = delete;
+  CoroutineExecutor& operator=(const CoroutineExecutor&) = delete;
+
+  // Destroys the frames of consumers that have not finished; run() must have
+  // returned.
+  ~CoroutineExecutor() {
+    for (Waiter* waiter : waiting_) {
+      waiter->handle.destroy();
+    }
+    for (auto handle : runnable_) {
+      handle.destroy();
+    }
+    for (auto handle : spawned_) {
+      handle.destroy();
+    }
+  }
+
+  EpochWaitStrategy& getWaitStrategy() { return *waitStrategy_; }
+
+  // Thread-safe. The task first runs on the executor thread.
+  void spawn(ConsumerTask task) {
+    ConsumerTask::Handle handle = task.release();
+    if (!handle) {
+      throw std::invalid_argument("ConsumerTask has already been spawned");
+    }
+    {
+      std::lock_guard<std::mutex> lock(spawnMutex_);
+      spawned_.push_back(handle);
+      hasSpawned_.store(true, std::memory_order_release);
+    }
+    taskCount_.fetch_add(1, std::memory_order_relaxed);
+    waitStrategy_->wakeAll();
+  }
+
+  // Consumers spawned and not yet finished.
+  int64_t getTaskCount() const { return taskCount_.load(std::memory_order_acquire); }
+
+  void halt() {
+    running_.store(HALTED, std::memory_order_seq_cst);
+    waitStrategy_->wakeAll();
+  }
+
+  bool isRunning() const { return running_.load(std::memory_order_acquire) != IDLE; }
+
+  void run() {
+    int expected = IDLE;
+    if (!running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
+      if (expected == RUNNING) {
+        throw std::runtime_error("Thread is already running");
+      }
+      return;
+    }
+
+    try {
+      processTasks();
+    } catch (...) {
+      running_.store(IDLE, std::memory_order_release);
+      throw;
+    }
+    running_.store(IDLE, std::memory_order_release);
+  }
+
+  // Called by awaiters from the executor thread.
+  bool takeInlineBudget() { return inlineBudget_-- > 0; }
+  void yield(ConsumerTask::Handle handle) { runnable_.push_back(handle); }
+  void wait(Waiter& waiter) { waiting_.push_back(&waiter); }
+
+private:
+  static constexpr int IDLE = 0;
+  static constexpr int HALTED = IDLE + 1;
+  static constexpr int RUNNING = HALTED + 1;
+
+  std::atomic<int> running_;
+  EpochWaitStrategy* waitStrategy_;
+  int idleSpins_;
+  int inlineBudget_ = 0;
+  std::atomic<int64_t> taskCount_{0};
+
+  std::mutex spawnMutex_;
+  std::atomic<bool> hasSpawned_{false};
+  std::vector<ConsumerTask::Handle> spawned_;
+
+  // Executor thread only.
+  std::vector<ConsumerTask::Handle> runnable_;
+  std::vector<ConsumerTask::Handle> resuming_;
+  std::vector<Waiter*> waiting_;
+
+  void resume(ConsumerTask::Handle handle) {
+    inlineBudget_ = kMaxInlineBatches;
+    handle.resume();
+    if (!handle.done()) {
+      return;
+    }
+    std::exception_ptr exception = std::move(handle.promise().exception);
+    handle.destroy();
+    taskCount_.fetch_sub(1, std::memory_order_release);
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  bool runOnce() {
+    if (hasSpawned_.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> lock(spawnMutex_);
+      runnable_.insert(runnable_.end(), spawned_.begin(), spawned_.end());
+      spawned_.clear();
+      hasSpawned_.store(false, std::memory_order_relaxed);
+    }
+
+    bool progressed = !runnable_.empty();
+    resuming_.swap(runnable_);
+    for (size_t i = 0; i < resuming_.size(); ++i) {
+      try {
+        resume(resuming_[i]);
+      } catch (...) {
+        // Keep the rest owned so the destructor can still free them.
+        runnable_.insert(runnable_.end(), resuming_.begin() + static_cast<std::ptrdiff_t>(i) + 1, resuming_.end());
+        resuming_.clear();
+        throw;
+      }
+    }
+    resuming_.clear();
+
+    // Swap-remove before resuming: the coroutine may suspend again and
+    // append itself to waiting_.
+    for (size_t i = 0; i < waiting_.size();) {
+      Waiter* waiter = waiting_[i];
+      if (!waiter->poll()) {
+        ++i;
+        continue;
+      }
+      waiting_[i] = waiting_.back();
+      waiting_.pop_back();
+      progressed = true;
+      resume(waiter->handle);
+    }
+    return progressed;
+  }
+
+  bool anyRunnable() {
+    if (hasSpawned_.load(std::memory_order_acquire) || !runnable_.empty()) {
+      return true;
+    }
+    for (Waiter* waiter : waiting_) {
+      if (waiter->poll()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void processTasks() {
+    int idlePasses = 0;
+    while (running_.load(std::memory_order_acquire) == RUNNING) {
+      if (runOnce()) {
+        idlePasses = 0;
+        continue;
+      }
+      if (++idlePasses < idleSpins_) {
+        disruptor::util::ThreadHints::onSpinWait();
+        continue;
+      }
+
+      const uint32_t epoch = waitStrategy_->prepareToPark();
+      if (running_.load(std::memory_order_acquire) != RUNNING) {
+        break;
+      }
+      if (anyRunnable()) {
+        idlePasses = 0;
+        continue;
+      }
+      waitStrategy_->park(epoch);
+    }
+  }
+};
+
+} // namespace disruptor
@@ -0,0 +1,85 @@
+#pragma once
+// Blocking wait strategy that can be shared by many ring buffers.
+//
+// Waiters park on a single epoch counter instead of a per-ring condition
+// variable, so one thread can sleep until *any* ring that uses this strategy
+// publishes (see MultiRingProcessor). Like LiteBlockingWaitStrategy, a
+// publisher only pays for a wake-up when someone is parked; otherwise the
+// cost of signalAllWhenBlocking() is a fence and a relaxed load.
+//
+// Parking protocol for custom consumers:
+//
+//   auto epoch = ws.prepareToPark();   // announce, then snapshot the epoch
+//   if (nothing available on any ring) // re-check after announcing
+//     ws.park(epoch);                  // returns once the epoch has moved
+//
+// It also works as an ordinary WaitStrategy for BatchEventProcessor.
+
+#include "Sequence.h"
+#include "WaitStrategy.h"
+#include "util/ThreadHints.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace disruptor {
+
+class EpochWaitStrategy final {
+public:
+  static constexpr bool kIsBlockingStrategy = true;
+
+  template <typename Barrier>
+  int64_t waitFor(int64_t sequence,
+                  const Sequence& cursorSequence,
+                  const Sequence& dependentSequence,
+                  Barrier& barrier) {
+    int64_t availableSequence;
+    while (cursorSequence.get() < sequence) {
+      const uint32_t epoch = prepareToPark();
+      if (cursorSequence.get() >= sequence) {
+        break;
+      }
+      barrier.checkAlert();
+      park(epoch);
+    }
+
+    while ((availableSequence = dependentSequence.get()) < sequence) {
+      barrier.checkAlert();
+      disruptor::util::ThreadHints::onSpinWait();
+    }
+
+    return availableSequence;
+  }
+
+  void signalAllWhenBlocking() {
+    // Pairs with the fence in prepareToPark(): either the waiter sees our
+    // publish when it re-checks, or we see its parked flag here.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked_.load(std::memory_order_relaxed) && parked_.exchange(false, std::memory_order_acq_rel)) {
+      wakeAll();
+    }
+  }
+
+  // Announce the intention to park and return the epoch to pass to park().
+  // The caller must re-check its rings after this call and before parking.
+  uint32_t prepareToPark() {
+    parked_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return epoch_.load(std::memory_order_acquire);
+  }
+
+  // Block until the epoch differs from the value prepareToPark() returned.
+  void park(uint32_t epoch) { epoch_.wait(epoch, std::memory_order_acquire); }
+
+  // Wake every parked waiter unconditionally (e.g. to deliver a halt).
+  void wakeAll() {
+    epoch_.fetch_add(1, std::memory_order_release);
+    epoch_.notify_all();
+  }
+
+private:
+  alignas(64) std::atomic<bool> parked_{false};
+  alignas(64) std::atomic<uint32_t> epoch_{0};
+};
+
+} // namespace disruptor
@@ -6,8 +6,10 @@
 #include "FixedSequenceGroup.h"
 #include "Sequence.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -30,10 +32,20 @@ public:
         gatingSequence_(&gatingSequence), fixedGroup_(nullptr) {}
 
   PollState poll(Handler &eventHandler) {
+    return poll(eventHandler, std::numeric_limits<int64_t>::max());
+  }
+
+  // C++ addition: hand at most maxBatchSize events to the handler per call
+  // (endOfBatch marks the last of them), so one thread can poll several
+  // pollers fairly.
+  PollState poll(Handler &eventHandler, int64_t maxBatchSize) {
     const int64_t currentSequence = sequence_->get();
     int64_t nextSequence = currentSequence + 1;
-    const int64_t availableSequence = sequencer_->getHighestPublishedSequence(
+    int64_t availableSequence = sequencer_->getHighestPublishedSequence(
         nextSequence, gatingSequence_->get());
+    if (availableSequence - currentSequence > maxBatchSize) {
+      availableSequence = currentSequence + std::max<int64_t>(maxBatchSize, 1);
+    }
 
     if (nextSequence <= availableSequence) {
       bool processNextEvent;
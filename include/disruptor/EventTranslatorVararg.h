@@ -12,6 +12,7 @@ class EventTranslatorVararg {
 public:
   virtual ~EventTranslatorVararg() = default;
   // Java uses Object... args. In C++ we model as an array of opaque pointers.
+  // Prefer RingBuffer::publishEvent(fn, args...), which needs no boxing.
   virtual void translateTo(T& event, int64_t sequence, const std::vector<void*>& args) = 0;
 };
 
@@ -12,6 +12,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 #include <vector>
@@ -56,9 +57,17 @@ public:
 
     if (wrapPoint > cachedGatingSequence || cachedGatingSequence > current) {
       int64_t gatingSequence;
+      int64_t waitStartNanos = 0;
       while (wrapPoint > (gatingSequence = minimumSequence(current))) {
+        if (waitStartNanos == 0) {
+          waitStartNanos = disruptor::util::Util::nanoTime();
+        }
         std::this_thread::yield();
       }
+      if (waitStartNanos != 0) {
+        this->recordWrapWait(disruptor::util::Util::nanoTime() -
+                             waitStartNanos);
+      }
       gatingSequenceCache_.set(gatingSequence);
     }
 
@@ -68,6 +77,18 @@ public:
   int64_t tryNext() { return tryNext(1); }
 
   int64_t tryNext(int n) {
+    const std::optional<int64_t> next = tryClaim(n);
+    if (!next) {
+      throw InsufficientCapacityException::INSTANCE();
+    }
+    return *next;
+  }
+
+  // C++ addition: tryNext() that reports a full ring as std::nullopt instead
+  // of throwing, for callers that shed load on rejection.
+  std::optional<int64_t> tryClaim() { return tryClaim(1); }
+
+  std::optional<int64_t> tryClaim(int n) {
     if (n < 1) {
       throw std::invalid_argument("n must be > 0");
     }
@@ -80,7 +101,7 @@ public:
 
       auto snap = this->gatingSequences_.load(std::memory_order_acquire);
       if (!hasAvailableCapacity(snap.get(), n, current)) {
-        throw InsufficientCapacityException::INSTANCE();
+        return std::nullopt;
       }
     } while (!this->cursor_.compareAndSet(current, next));
 
@@ -0,0 +1,207 @@
+#pragma once
+// One consumer thread servicing many ring buffers round-robin, at most
+// maxBatchPerRing events per ring per pass. Every ring must use the
+// EpochWaitStrategy instance passed to the constructor. Rings and handlers must
+// outlive the processor; add rings before run().
+
+#include "EpochWaitStrategy.h"
+#include "EventHandlerBase.h"
+#include "EventPoller.h"
+#include "ExceptionHandler.h"
+#include "ExceptionHandlers.h"
+#include "Sequence.h"
+#include "util/ThreadHints.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace disruptor {
+
+class MultiRingProcessor final {
+public:
+  explicit MultiRingProcessor(EpochWaitStrategy& waitStrategy, int maxBatchPerRing = 64, int idleSpins = 100)
+      : running_(IDLE), waitStrategy_(&waitStrategy), maxBatchPerRing_(maxBatchPerRing), idleSpins_(idleSpins) {
+    if (maxBatchPerRing < 1) {
+      throw std::invalid_argument("maxBatchPerRing must be greater than 0");
+    }
+  }
+
+  MultiRingProcessor(const MultiRingProcessor&) = delete;
+  MultiRingProcessor& operator=(const MultiRingProcessor&) = delete;
+
+  // Returns the poller's sequence, which gates ringBuffer and can be used as
+  // a dependency for downstream consumers of that ring.
+  template <typename RingBufferT, typename T>
+  Sequence& addRing(RingBufferT& ringBuffer, EventHandlerBase<T>& eventHandler,
+                    ExceptionHandler<T>* exceptionHandler = nullptr) {
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(ringBuffer.getSequencer().getWaitStrategy())>,
+                                 EpochWaitStrategy>,
+                  "MultiRingProcessor rings must use EpochWaitStrategy");
+    if (&ringBuffer.getSequencer().getWaitStrategy() != waitStrategy_) {
+      throw std::invalid_argument("Ring buffer does not share this processor's EpochWaitStrategy");
+    }
+    if (running_.load(std::memory_order_acquire) != IDLE) {
+      throw std::runtime_error("Rings must be added before the processor is started");
+    }
+
+    using SequencerT = std::remove_cvref_t<decltype(ringBuffer.getSequencer())>;
+    auto source =
+        std::make_unique<RingSource<T, SequencerT>>(*this, ringBuffer.newPoller(), eventHandler, exceptionHandler);
+    Sequence& sequence = source->getSequence();
+    ringBuffer.addGatingSequences(sequence);
+    sources_.push_back(std::move(source));
+    return sequence;
+  }
+
+  int getRingCount() const { return static_cast<int>(sources_.size()); }
+
+  void halt() {
+    running_.store(HALTED, std::memory_order_seq_cst);
+    waitStrategy_->wakeAll();
+  }
+
+  bool isRunning() const { return running_.load(std::memory_order_acquire) != IDLE; }
+
+  void run() {
+    int expected = IDLE;
+    if (!running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
+      if (expected == RUNNING) {
+        throw std::runtime_error("Thread is already running");
+      }
+      return;
+    }
+
+    for (auto& source : sources_) {
+      source->onStart();
+    }
+    processEvents();
+    notifyShutdown();
+    running_.store(IDLE, std::memory_order_release);
+  }
+
+private:
+  static constexpr int IDLE = 0;
+  static constexpr int HALTED = IDLE + 1;
+  static constexpr int RUNNING = HALTED + 1;
+
+  class Source {
+  public:
+    virtual ~Source() = default;
+    // true if any event was handled
+    virtual bool poll(int maxBatch) = 0;
+    virtual Sequence& getSequence() = 0;
+    virtual void onStart() = 0;
+    virtual void onShutdown() = 0;
+  };
+
+  template <typename T, typename SequencerT>
+  class RingSource final : public Source, private EventPoller<T, SequencerT>::Handler {
+  public:
+    using PollerT = EventPoller<T, SequencerT>;
+
+    RingSource(MultiRingProcessor& processor, std::shared_ptr<PollerT> poller, EventHandlerBase<T>& eventHandler,
+               ExceptionHandler<T>* exceptionHandler)
+        : processor_(&processor),
+          poller_(std::move(poller)),
+          eventHandler_(&eventHandler),
+          exceptionHandler_(exceptionHandler) {}
+
+    bool poll(int maxBatch) override {
+      return poller_->poll(*this, maxBatch) == PollerT::PollState::PROCESSING;
+    }
+
+    Sequence& getSequence() override { return poller_->getSequence(); }
+
+    void onStart() override {
+      try {
+        eventHandler_->onStart();
+      } catch (const std::exception& ex) {
+        getExceptionHandler().handleOnStartException(ex);
+      }
+    }
+
+    void onShutdown() override {
+      try {
+        eventHandler_->onShutdown();
+      } catch (const std::exception& ex) {
+        getExceptionHandler().handleOnShutdownException(ex);
+      }
+    }
+
+  private:
+    bool onEvent(T& event, int64_t sequence, bool endOfBatch) override {
+      try {
+        eventHandler_->onEvent(event, sequence, endOfBatch);
+      } catch (const std::exception& ex) {
+        // Handled: the event counts as processed. A rethrow stops the
+        // processor, as in BatchEventProcessor, rather than leaving run().
+        try {
+          getExceptionHandler().handleEventException(ex, sequence, &event);
+        } catch (...) {
+          processor_->halt();
+          return false;
+        }
+      }
+      return true;
+    }
+
+    ExceptionHandler<T>& getExceptionHandler() {
+      return exceptionHandler_ == nullptr ? *ExceptionHandlers::defaultHandler<T>() : *exceptionHandler_;
+    }
+
+    MultiRingProcessor* processor_;
+    std::shared_ptr<PollerT> poller_;
+    EventHandlerBase<T>* eventHandler_;
+    ExceptionHandler<T>* exceptionHandler_;
+  };
+
+  std::atomic<int> running_;
+  EpochWaitStrategy* waitStrategy_;
+  int maxBatchPerRing_;
+  int idleSpins_;
+  std::vector<std::unique_ptr<Source>> sources_;
+
+  bool pollAll() {
+    bool processed = false;
+    for (auto& source : sources_) {
+      processed |= source->poll(maxBatchPerRing_);
+    }
+    return processed;
+  }
+
+  void processEvents() {
+    int idlePasses = 0;
+    while (running_.load(std::memory_order_acquire) == RUNNING) {
+      if (pollAll()) {
+        idlePasses = 0;
+        continue;
+      }
+      if (++idlePasses < idleSpins_) {
+        disruptor::util::ThreadHints::onSpinWait();
+        continue;
+      }
+
+      const uint32_t epoch = waitStrategy_->prepareToPark();
+      if (running_.load(std::memory_order_acquire) != RUNNING) {
+        break;
+      }
+      if (pollAll()) {
+        idlePasses = 0;
+        continue;
+      }
+      waitStrategy_->park(epoch);
+    }
+  }
+
+  void notifyShutdown() {
+    for (auto& source : sources_) {
+      source->onShutdown();
+    }
+  }
+};
+
+} // namespace disruptor
@@ -0,0 +1,125 @@
+#pragma once
+// Single-producer sequencer that never waits for consumers: the producer laps
+// them and overwrites what they have not read. Events must be trivially
+// copyable; BatchEventProcessor skips overwritten events and counts them in
+// getDroppedCount().
+
+#include "AbstractSequencer.h"
+#include "ProcessingSequenceBarrier.h"
+#include "Sequence.h"
+#include "WaitStrategy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace disruptor {
+
+template <typename WaitStrategyT>
+class OverwritingSequencer final : public AbstractSequencer<WaitStrategyT> {
+public:
+  OverwritingSequencer(int bufferSize, WaitStrategyT &waitStrategy)
+      : AbstractSequencer<WaitStrategyT>(bufferSize, waitStrategy),
+        nextValue_(Sequence::INITIAL_VALUE),
+        claimed_(Sequence::INITIAL_VALUE),
+        stamps_(static_cast<size_t>(bufferSize)),
+        indexMask_(bufferSize - 1) {
+    for (auto &stamp : stamps_) {
+      stamp.store(kRewriting, std::memory_order_relaxed);
+    }
+  }
+
+  // The producer never waits, so there is always capacity.
+  bool hasAvailableCapacity(int /*requiredCapacity*/) { return true; }
+  int64_t remainingCapacity() { return this->getBufferSize(); }
+
+  int64_t next() { return next(1); }
+
+  int64_t next(int n) {
+    if (n < 1 || n > this->bufferSize_) {
+      throw std::invalid_argument("n must be > 0 and <= bufferSize");
+    }
+    const int64_t nextSequence = nextValue_ + n;
+    for (int64_t sequence = nextValue_ + 1; sequence <= nextSequence; ++sequence) {
+      stamps_[static_cast<size_t>(sequence & indexMask_)].store(kRewriting, std::memory_order_relaxed);
+    }
+    // The cleared stamps must be visible before the slots are rewritten.
+    std::atomic_thread_fence(std::memory_order_release);
+    claimed_.set(nextSequence);
+    nextValue_ = nextSequence;
+    return nextSequence;
+  }
+
+  int64_t tryNext() { return next(1); }
+  int64_t tryNext(int n) { return next(n); }
+  std::optional<int64_t> tryClaim() { return next(1); }
+  std::optional<int64_t> tryClaim(int n) {
+    if (n < 1) {
+      throw std::invalid_argument("n must be > 0");
+    }
+    return next(n);
+  }
+
+  void claim(int64_t sequence) {
+    // Clear the stamps jumped over, as next() would, so stamps from an
+    // earlier lap cannot match them. Moving backwards clears the whole ring.
+    const int64_t jumped = sequence - nextValue_;
+    const int64_t toClear = jumped < 0 ? this->bufferSize_ : (std::min)(jumped, int64_t{this->bufferSize_});
+    for (int64_t i = 1; i <= toClear; ++i) {
+      stamps_[static_cast<size_t>((nextValue_ + i) & indexMask_)].store(kRewriting, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    nextValue_ = sequence;
+    claimed_.set(sequence);
+  }
+
+  void publish(int64_t sequence) { publish(sequence, sequence); }
+
+  void publish(int64_t lo, int64_t hi) {
+    for (int64_t sequence = lo; sequence <= hi; ++sequence) {
+      stamps_[static_cast<size_t>(sequence & indexMask_)].store(sequence, std::memory_order_release);
+    }
+    this->cursor_.set(hi);
+    if constexpr (WaitStrategyT::kIsBlockingStrategy) {
+      this->waitStrategy_->signalAllWhenBlocking();
+    }
+  }
+
+  // true while the slot still holds the published event for sequence.
+  bool isIntact(int64_t sequence) const {
+    return stamps_[static_cast<size_t>(sequence & indexMask_)].load(std::memory_order_acquire) == sequence;
+  }
+
+  bool isAvailable(int64_t sequence) const { return isIntact(sequence); }
+
+  // Lowest sequence whose slot has not been claimed for a newer event.
+  int64_t getOldestIntactSequence() const { return claimed_.get() - this->bufferSize_ + 1; }
+
+  // Does not consult the stamps: callers check isIntact() per slot, which is
+  // why RingBuffer::newPoller() is unavailable on overwriting rings.
+  int64_t getHighestPublishedSequence(int64_t /*lowerBound*/, int64_t availableSequence) {
+    return availableSequence;
+  }
+
+  std::shared_ptr<ProcessingSequenceBarrier<OverwritingSequencer<WaitStrategyT>, WaitStrategyT>>
+  newBarrier(Sequence *const *sequencesToTrack, int count) {
+    return std::make_shared<ProcessingSequenceBarrier<OverwritingSequencer<WaitStrategyT>, WaitStrategyT>>(
+        *this, *this->waitStrategy_, this->cursor_, sequencesToTrack, count);
+  }
+
+private:
+  static constexpr int64_t kRewriting = -1;
+
+  // Producer-local.
+  int64_t nextValue_;
+  // Highest claimed sequence, for readers that need to skip ahead.
+  Sequence claimed_;
+  std::vector<std::atomic<int64_t>> stamps_;
+  int64_t indexMask_;
+};
+
+} // namespace disruptor
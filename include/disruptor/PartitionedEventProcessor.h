@@ -0,0 +1,334 @@
+#pragma once
+// Keyed partitioned dispatch: a PartitionDispatcher reads each event's key and
+// hands the sequence to one of N PartitionEventProcessors, so each key is
+// handled by one handler, in order. An idle partition's Sequence follows the
+// dispatcher, so it never holds back the producer.
+
+#include "AlertException.h"
+#include "DataProvider.h"
+#include "EventHandlerBase.h"
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+#include "ExceptionHandlers.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "TimeoutException.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+// BarrierT waits on the dispatcher's sequence.
+template <typename T, typename BarrierT>
+class PartitionEventProcessor final : public EventProcessor {
+public:
+  PartitionEventProcessor(DataProvider<T>& dataProvider,
+                          BarrierT& dispatchBarrier,
+                          EventHandlerBase<T>& eventHandler,
+                          int capacity)
+      : running_(IDLE),
+        exceptionHandler_(nullptr),
+        dataProvider_(&dataProvider),
+        sequenceBarrier_(&dispatchBarrier),
+        eventHandler_(&eventHandler),
+        sequence_(SEQUENCER_INITIAL_CURSOR_VALUE),
+        published_(0) {
+    if (capacity < 1 || (capacity & (capacity - 1)) != 0) {
+      throw std::invalid_argument("capacity must be a power of 2");
+    }
+    entries_.resize(static_cast<size_t>(capacity));
+    mask_ = capacity - 1;
+  }
+
+  Sequence& getSequence() override { return sequence_; }
+
+  void halt() override {
+    running_.store(HALTED, std::memory_order_release);
+    sequenceBarrier_->alert();
+  }
+
+  bool isRunning() override { return running_.load(std::memory_order_acquire) != IDLE; }
+
+  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) { exceptionHandler_ = &exceptionHandler; }
+
+  // Dispatcher side (single writer): queue a ring sequence for this partition,
+  // then make everything offered so far visible with publishOffered().
+  void offer(int64_t sequence) {
+    entries_[static_cast<size_t>(offered_ & mask_)] = sequence;
+    ++offered_;
+  }
+
+  void publishOffered() {
+    if (offered_ != published_.get()) {
+      published_.set(offered_);
+    }
+  }
+
+  void run() override {
+    int expected = IDLE;
+    if (running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
+      sequenceBarrier_->clearAlert();
+
+      notifyStart();
+      try {
+        if (running_.load(std::memory_order_acquire) == RUNNING) {
+          processEvents();
+        }
+      } catch (...) {
+        notifyShutdown();
+        running_.store(IDLE, std::memory_order_release);
+        throw;
+      }
+      notifyShutdown();
+      running_.store(IDLE, std::memory_order_release);
+    } else {
+      if (expected == RUNNING) {
+        throw std::runtime_error("Thread is already running");
+      }
+      notifyStart();
+      notifyShutdown();
+    }
+  }
+
+private:
+  static constexpr int IDLE = 0;
+  static constexpr int HALTED = IDLE + 1;
+  static constexpr int RUNNING = HALTED + 1;
+
+  std::atomic<int> running_;
+  ExceptionHandler<T>* exceptionHandler_;
+  DataProvider<T>* dataProvider_;
+  BarrierT* sequenceBarrier_;
+  EventHandlerBase<T>* eventHandler_;
+  Sequence sequence_;
+
+  // Index ring: entries_[offered_ & mask_] written by the dispatcher, counts
+  // published through published_; consumed_ is local to this processor.
+  std::vector<int64_t> entries_;
+  int64_t mask_{0};
+  int64_t offered_{0};
+  Sequence published_;
+  int64_t consumed_{0};
+
+  void processEvents() {
+    T* event = nullptr;
+    int64_t eventSequence = sequence_.get();
+    int64_t nextSequence = sequence_.get() + 1;
+
+    // Set only while onEvent runs for entries_[consumed_]; any other failure
+    // leaves the entry to be delivered on the next round.
+    bool inOnEvent = false;
+
+    while (true) {
+      try {
+        const int64_t availableSequence = sequenceBarrier_->waitFor(nextSequence);
+        if (availableSequence < nextSequence) {
+          continue;
+        }
+
+        // Everything the dispatcher handled up to availableSequence is already
+        // in the index ring; entries past it belong to the next round.
+        const int64_t published = published_.get();
+        int64_t endOfBatch = consumed_;
+        while (endOfBatch < published && entries_[static_cast<size_t>(endOfBatch & mask_)] <= availableSequence) {
+          ++endOfBatch;
+        }
+
+        if (consumed_ < endOfBatch) {
+          eventHandler_->onBatchStart(endOfBatch - consumed_, published - consumed_);
+        }
+        while (consumed_ < endOfBatch) {
+          eventSequence = entries_[static_cast<size_t>(consumed_ & mask_)];
+          event = &dataProvider_->get(eventSequence);
+          inOnEvent = true;
+          eventHandler_->onEvent(*event, eventSequence, consumed_ + 1 == endOfBatch);
+          inOnEvent = false;
+          ++consumed_;
+        }
+
+        sequence_.set(availableSequence);
+        nextSequence = availableSequence + 1;
+      } catch (const TimeoutException&) {
+        notifyTimeout(sequence_.get());
+      } catch (const AlertException&) {
+        if (running_.load(std::memory_order_acquire) != RUNNING) {
+          break;
+        }
+      } catch (const std::exception& ex) {
+        // Skip the entry only if its handler failed; the sequence catches up
+        // on the next round.
+        handleEventException(ex, eventSequence, inOnEvent ? event : nullptr);
+        if (inOnEvent) {
+          inOnEvent = false;
+          ++consumed_;
+        }
+      }
+    }
+  }
+
+  void notifyTimeout(int64_t availableSequence) {
+    try {
+      eventHandler_->onTimeout(availableSequence);
+    } catch (const std::exception& e) {
+      handleEventException(e, availableSequence, nullptr);
+    }
+  }
+
+  void notifyStart() {
+    try {
+      eventHandler_->onStart();
+    } catch (const std::exception& ex) {
+      getExceptionHandler().handleOnStartException(ex);
+    }
+  }
+
+  void notifyShutdown() {
+    try {
+      eventHandler_->onShutdown();
+    } catch (const std::exception& ex) {
+      getExceptionHandler().handleOnShutdownException(ex);
+    }
+  }
+
+  void handleEventException(const std::exception& ex, int64_t sequence, T* event) {
+    // See BatchEventProcessor: an exception escaping the thread would terminate.
+    try {
+      getExceptionHandler().handleEventException(ex, sequence, event);
+    } catch (...) {
+      halt();
+    }
+  }
+
+  ExceptionHandler<T>& getExceptionHandler() {
+    return exceptionHandler_ == nullptr ? *ExceptionHandlers::defaultHandler<T>() : *exceptionHandler_;
+  }
+};
+
+// KeyFn: callable (const T&) -> key; the key is hashed with std::hash to pick
+// the partition, so every event with the same key goes to the same handler.
+template <typename T, typename BarrierT, typename PartitionT, typename KeyFn>
+class PartitionDispatcher final : public EventProcessor {
+public:
+  using KeyT = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+
+  PartitionDispatcher(DataProvider<T>& dataProvider, BarrierT& sequenceBarrier, KeyFn keyFn)
+      : running_(IDLE),
+        exceptionHandler_(nullptr),
+        dataProvider_(&dataProvider),
+        sequenceBarrier_(&sequenceBarrier),
+        keyFn_(std::move(keyFn)),
+        sequence_(SEQUENCER_INITIAL_CURSOR_VALUE) {}
+
+  // Called before run(); partitions are indexed in the order they are added.
+  void addPartition(PartitionT& partition) { partitions_.push_back(&partition); }
+
+  int getPartitionCount() const { return static_cast<int>(partitions_.size()); }
+
+  int partitionFor(const T& event) {
+    return static_cast<int>(std::hash<KeyT>{}(keyFn_(event)) % partitions_.size());
+  }
+
+  Sequence& getSequence() override { return sequence_; }
+
+  void halt() override {
+    running_.store(HALTED, std::memory_order_release);
+    sequenceBarrier_->alert();
+  }
+
+  bool isRunning() override { return running_.load(std::memory_order_acquire) != IDLE; }
+
+  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) { exceptionHandler_ = &exceptionHandler; }
+
+  void run() override {
+    if (partitions_.empty()) {
+      throw std::runtime_error("PartitionDispatcher has no partitions");
+    }
+    int expected = IDLE;
+    if (running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
+      sequenceBarrier_->clearAlert();
+      try {
+        if (running_.load(std::memory_order_acquire) == RUNNING) {
+          processEvents();
+        }
+      } catch (...) {
+        running_.store(IDLE, std::memory_order_release);
+        throw;
+      }
+      running_.store(IDLE, std::memory_order_release);
+    } else if (expected == RUNNING) {
+      throw std::runtime_error("Thread is already running");
+    }
+  }
+
+private:
+  static constexpr int IDLE = 0;
+  static constexpr int HALTED = IDLE + 1;
+  static constexpr int RUNNING = HALTED + 1;
+
+  std::atomic<int> running_;
+  ExceptionHandler<T>* exceptionHandler_;
+  DataProvider<T>* dataProvider_;
+  BarrierT* sequenceBarrier_;
+  KeyFn keyFn_;
+  std::vector<PartitionT*> partitions_;
+  Sequence sequence_;
+
+  void processEvents() {
+    T* event = nullptr;
+    int64_t nextSequence = sequence_.get() + 1;
+
+    while (true) {
+      try {
+        const int64_t availableSequence = sequenceBarrier_->waitFor(nextSequence);
+        if (availableSequence < nextSequence) {
+          continue;
+        }
+
+        while (nextSequence <= availableSequence) {
+          event = &dataProvider_->get(nextSequence);
+          partitions_[static_cast<size_t>(partitionFor(*event))]->offer(nextSequence);
+          ++nextSequence;
+        }
+
+        // Entries must be visible before the sequence that covers them.
+        publishOffered();
+        sequence_.set(availableSequence);
+      } catch (const TimeoutException&) {
+        // Nothing to notify: the dispatcher has no handler of its own.
+      } catch (const AlertException&) {
+        if (running_.load(std::memory_order_acquire) != RUNNING) {
+          break;
+        }
+      } catch (const std::exception& ex) {
+        // The key could not be read: the event goes to no partition.
+        try {
+          getExceptionHandler().handleEventException(ex, nextSequence, event);
+        } catch (...) {
+          halt();
+        }
+        publishOffered();
+        sequence_.set(nextSequence);
+        ++nextSequence;
+      }
+    }
+  }
+
+  void publishOffered() {
+    for (PartitionT* partition : partitions_) {
+      partition->publishOffered();
+    }
+  }
+
+  ExceptionHandler<T>& getExceptionHandler() {
+    return exceptionHandler_ == nullptr ? *ExceptionHandlers::defaultHandler<T>() : *exceptionHandler_;
+  }
+};
+
+} // namespace disruptor
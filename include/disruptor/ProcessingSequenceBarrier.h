@@ -6,6 +6,7 @@
 #include "FixedSequenceGroup.h"
 #include "Sequence.h"
 #include "SequenceBarrier.h"
+#include "Sequencer.h"
 #include "TimeoutException.h"
 #include "WaitStrategy.h"
 
@@ -53,8 +54,36 @@ public:
     return sequencer_->getHighestPublishedSequence(sequence, availableSequence);
   }
 
+  // C++ addition: waitFor() without the wait. Returns the highest sequence
+  // that can be consumed now, which is below `sequence` if it is not yet
+  // available. Used by consumers that must not block, e.g. coroutines.
+  int64_t tryWaitFor(int64_t sequence) {
+    checkAlert();
+
+    const int64_t availableSequence = dependentSequence_->get();
+    if (availableSequence < sequence) {
+      return availableSequence;
+    }
+
+    return sequencer_->getHighestPublishedSequence(sequence, availableSequence);
+  }
+
   int64_t getCursor() const { return dependentSequence_->get(); }
 
+  // C++ addition: overrun checks for sequencers that overwrite unconsumed
+  // events (see OverwritingSequencer.h).
+  bool isIntact(int64_t sequence) const
+    requires OverwritingSequencerType<SequencerT>
+  {
+    return sequencer_->isIntact(sequence);
+  }
+
+  int64_t getOldestIntactSequence() const
+    requires OverwritingSequencerType<SequencerT>
+  {
+    return sequencer_->getOldestIntactSequence();
+  }
+
   bool isAlerted() const { return alerted_.load(std::memory_order_acquire); }
 
   void alert() {
@@ -0,0 +1,285 @@
+#pragma once
+// EventProcessor that forwards a source ring's events into one or more target
+// rings, with one claim and one publish per target per batch. Events sent to
+// the same target keep their source order. A target's consumers must not wait
+// on another target of the same bridge.
+
+#include "AlertException.h"
+#include "DataProvider.h"
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+#include "ExceptionHandlers.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "TimeoutException.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+// Default router: every event goes to the only target.
+struct SingleTargetRouter final {
+  template <typename S>
+  size_t operator()(const S& /*event*/, int64_t /*sequence*/) const {
+    return 0;
+  }
+};
+
+// translator(const S& source, D& target) fills a target slot; if it throws,
+// the slot is still published. router(const S& source, int64_t sequence)
+// returns the target index; if it throws or names no target, the event is
+// dropped. Both failures are reported to the exception handler.
+template <typename S, typename BarrierT, typename TargetRingT, typename Translator,
+          typename Router = SingleTargetRouter>
+class RingBridge final : public EventProcessor {
+public:
+  using TargetEvent = typename TargetRingT::EventType;
+
+  RingBridge(DataProvider<S>& source,
+             BarrierT& sequenceBarrier,
+             TargetRingT& target,
+             Translator translator,
+             int maxBatchSize = (std::numeric_limits<int>::max)())
+      : RingBridge(source, sequenceBarrier, std::vector<TargetRingT*>{&target}, std::move(translator), Router{},
+                   maxBatchSize) {}
+
+  RingBridge(DataProvider<S>& source,
+             BarrierT& sequenceBarrier,
+             TargetRingT* const* targets,
+             int targetCount,
+             Translator translator,
+             Router router,
+             int maxBatchSize = (std::numeric_limits<int>::max)())
+      : RingBridge(source, sequenceBarrier, std::vector<TargetRingT*>(targets, targets + targetCount),
+                   std::move(translator), std::move(router), maxBatchSize) {}
+
+  RingBridge(const RingBridge&) = delete;
+  RingBridge& operator=(const RingBridge&) = delete;
+
+  Sequence& getSequence() override { return sequence_; }
+
+  void halt() override {
+    running_.store(HALTED, std::memory_order_release);
+    sequenceBarrier_->alert();
+  }
+
+  bool isRunning() override { return running_.load(std::memory_order_acquire) != IDLE; }
+
+  void setExceptionHandler(ExceptionHandler<S>& exceptionHandler) { exceptionHandler_ = &exceptionHandler; }
+
+  int getMaxBatchSize() const { return maxBatchSize_; }
+
+  void run() override {
+    int expected = IDLE;
+    if (!running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
+      if (expected == RUNNING) {
+        throw std::runtime_error("Thread is already running");
+      }
+      return;
+    }
+    sequenceBarrier_->clearAlert();
+
+    try {
+      processEvents();
+    } catch (...) {
+      running_.store(IDLE, std::memory_order_release);
+      throw;
+    }
+    running_.store(IDLE, std::memory_order_release);
+  }
+
+private:
+  static constexpr int IDLE = 0;
+  static constexpr int HALTED = IDLE + 1;
+  static constexpr int RUNNING = HALTED + 1;
+  static constexpr bool kSingleTarget = std::is_same_v<Router, SingleTargetRouter>;
+
+  RingBridge(DataProvider<S>& source,
+             BarrierT& sequenceBarrier,
+             std::vector<TargetRingT*> targets,
+             Translator translator,
+             Router router,
+             int maxBatchSize)
+      : running_(IDLE),
+        sequence_(SEQUENCER_INITIAL_CURSOR_VALUE),
+        source_(&source),
+        sequenceBarrier_(&sequenceBarrier),
+        targets_(std::move(targets)),
+        translator_(std::move(translator)),
+        router_(std::move(router)),
+        exceptionHandler_(nullptr),
+        maxBatchSize_(maxBatchSize) {
+    if (targets_.empty()) {
+      throw std::invalid_argument("RingBridge requires at least one target");
+    }
+    if (maxBatchSize < 1) {
+      throw std::invalid_argument("maxBatchSize must be greater than 0");
+    }
+    for (TargetRingT* target : targets_) {
+      maxBatchSize_ = (std::min)(maxBatchSize_, target->getBufferSize());
+    }
+    if constexpr (!kSingleTarget) {
+      routes_.resize(static_cast<size_t>(maxBatchSize_));
+      counts_.resize(targets_.size());
+      claimed_.resize(targets_.size());
+      cursors_.resize(targets_.size());
+    }
+  }
+
+  std::atomic<int> running_;
+  Sequence sequence_;
+  DataProvider<S>* source_;
+  BarrierT* sequenceBarrier_;
+  std::vector<TargetRingT*> targets_;
+  Translator translator_;
+  [[no_unique_address]] Router router_;
+  ExceptionHandler<S>* exceptionHandler_;
+  int maxBatchSize_;
+
+  static constexpr uint32_t kDropped = std::numeric_limits<uint32_t>::max();
+
+  // Per-batch scratch for the routed path, sized once.
+  std::vector<uint32_t> routes_;
+  std::vector<int> counts_;
+  std::vector<int64_t> claimed_;
+  std::vector<int64_t> cursors_;
+
+  void processEvents() {
+    int64_t nextSequence = sequence_.get() + 1;
+    while (true) {
+      try {
+        const int64_t availableSequence = sequenceBarrier_->waitFor(nextSequence);
+        if (availableSequence < nextSequence) {
+          continue;
+        }
+        const int64_t endOfBatchSequence = (std::min)(nextSequence + maxBatchSize_ - 1, availableSequence);
+        if constexpr (kSingleTarget) {
+          transferToSingleTarget(nextSequence, endOfBatchSequence);
+        } else {
+          transferRouted(nextSequence, endOfBatchSequence);
+        }
+        sequence_.set(endOfBatchSequence);
+        nextSequence = endOfBatchSequence + 1;
+      } catch (const TimeoutException&) {
+        // No timeout callback: nothing to flush.
+      } catch (const AlertException&) {
+        if (running_.load(std::memory_order_acquire) != RUNNING) {
+          break;
+        }
+      }
+    }
+  }
+
+  void translate(int64_t sourceSequence, TargetEvent& target) {
+    S& event = source_->get(sourceSequence);
+    try {
+      translator_(static_cast<const S&>(event), target);
+    } catch (const std::exception& ex) {
+      handleEventException(ex, sourceSequence, &event);
+    }
+  }
+
+  void transferToSingleTarget(int64_t lo, int64_t hi) {
+    TargetRingT& target = *targets_[0];
+    const int n = static_cast<int>(hi - lo + 1);
+    const int64_t targetHi = target.next(n);
+    const int64_t targetLo = targetHi - (n - 1);
+    try {
+      for (int i = 0; i < n; ++i) {
+        translate(lo + i, target.get(targetLo + i));
+      }
+    } catch (...) {
+      target.publish(targetLo, targetHi);
+      throw;
+    }
+    target.publish(targetLo, targetHi);
+  }
+
+  void transferRouted(int64_t lo, int64_t hi) {
+    const int n = static_cast<int>(hi - lo + 1);
+    const size_t targetCount = targets_.size();
+    std::fill(counts_.begin(), counts_.end(), 0);
+    for (int i = 0; i < n; ++i) {
+      routes_[static_cast<size_t>(i)] = route(lo + i, targetCount);
+    }
+
+    // One claim per target that has events in this batch.
+    size_t claimedTargets = 0;
+    try {
+      for (; claimedTargets < targetCount; ++claimedTargets) {
+        const int count = counts_[claimedTargets];
+        if (count > 0) {
+          claimed_[claimedTargets] = targets_[claimedTargets]->next(count);
+          cursors_[claimedTargets] = claimed_[claimedTargets] - (count - 1);
+        }
+      }
+      for (int i = 0; i < n; ++i) {
+        const uint32_t route = routes_[static_cast<size_t>(i)];
+        if (route != kDropped) {
+          translate(lo + i, targets_[route]->get(cursors_[route]++));
+        }
+      }
+    } catch (...) {
+      publishClaimed(claimedTargets);
+      throw;
+    }
+    publishClaimed(targetCount);
+  }
+
+  // The event's target, or kDropped if the router threw or named no target.
+  uint32_t route(int64_t sourceSequence, size_t targetCount) {
+    S& event = source_->get(sourceSequence);
+    try {
+      const size_t target = router_(static_cast<const S&>(event), sourceSequence);
+      if (target >= targetCount) {
+        throw std::out_of_range("RingBridge router returned an unknown target");
+      }
+      ++counts_[target];
+      return static_cast<uint32_t>(target);
+    } catch (const std::exception& ex) {
+      handleEventException(ex, sourceSequence, &event);
+    }
+    return kDropped;
+  }
+
+  void publishClaimed(size_t claimedTargets) {
+    for (size_t t = 0; t < claimedTargets; ++t) {
+      const int count = counts_[t];
+      if (count > 0) {
+        targets_[t]->publish(claimed_[t] - (count - 1), claimed_[t]);
+      }
+    }
+  }
+
+  void handleEventException(const std::exception& ex, int64_t sequence, S* event) {
+    // See BatchEventProcessor: a rethrow escaping the thread would terminate,
+    // so halt and let processEvents() leave through the alert.
+    try {
+      getExceptionHandler().handleEventException(ex, sequence, event);
+    } catch (...) {
+      halt();
+    }
+  }
+
+  ExceptionHandler<S>& getExceptionHandler() {
+    return exceptionHandler_ == nullptr ? *ExceptionHandlers::defaultHandler<S>() : *exceptionHandler_;
+  }
+};
+
+template <typename S, typename BarrierT, typename TargetRingT, typename Translator>
+RingBridge(DataProvider<S>&, BarrierT&, TargetRingT&, Translator, int = 0)
+    -> RingBridge<S, BarrierT, TargetRingT, Translator>;
+
+template <typename S, typename BarrierT, typename TargetRingT, typename Translator, typename Router>
+RingBridge(DataProvider<S>&, BarrierT&, TargetRingT* const*, int, Translator, Router, int = 0)
+    -> RingBridge<S, BarrierT, TargetRingT, Translator, Router>;
+
+} // namespace disruptor
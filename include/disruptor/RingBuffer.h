@@ -4,6 +4,7 @@
 
 #include "AbstractSequencer.h"
 #include "BlockingWaitStrategy.h"
+#include "ClaimedSlot.h"
 #include "Cursored.h"
 #include "DataProvider.h"
 #include "EventFactory.h"
@@ -14,6 +15,8 @@
 #include "EventTranslatorTwoArg.h"
 #include "EventTranslatorVararg.h"
 #include "MultiProducerSequencer.h"
+#include "OverwritingSequencer.h"
+#include "RingBufferTracing.h"
 #include "Sequence.h"
 #include "Sequencer.h"
 #include "SingleProducerSequencer.h"
@@ -21,41 +24,66 @@
 
 #include "dsl/ProducerType.h"
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace disruptor {
 
-// Template RingBuffer: parameterized by the concrete Sequencer type.
-template <typename E, typename SequencerT>
+// Template RingBuffer: parameterized by the concrete Sequencer type and an
+// optional claim/publish tracing policy (see RingBufferTracing.h).
+template <typename E, typename SequencerT, typename TracingT = NoOpRingBufferTracing>
 class RingBuffer final : public DataProvider<E>, public Cursored {
 public:
   static constexpr int64_t INITIAL_CURSOR_VALUE = Sequence::INITIAL_VALUE;
   using SequencerType = SequencerT;
+  using EventType = E;
+  using TracingType = TracingT;
 
   // Factory methods
   template <typename WaitStrategyT>
-  static std::shared_ptr<RingBuffer<E, MultiProducerSequencer<WaitStrategyT>>>
+  static std::shared_ptr<RingBuffer<E, MultiProducerSequencer<WaitStrategyT>, TracingT>>
   createMultiProducer(std::shared_ptr<EventFactory<E>> factory, int bufferSize,
                       WaitStrategyT &waitStrategy) {
     using Seq = MultiProducerSequencer<WaitStrategyT>;
     auto seq = std::make_unique<Seq>(bufferSize, waitStrategy);
-    return std::shared_ptr<RingBuffer<E, Seq>>(
-        new RingBuffer<E, Seq>(std::move(factory), std::move(seq)));
+    return std::shared_ptr<RingBuffer<E, Seq, TracingT>>(
+        new RingBuffer<E, Seq, TracingT>(std::move(factory), std::move(seq)));
   }
 
   template <typename WaitStrategyT>
-  static std::shared_ptr<RingBuffer<E, SingleProducerSequencer<WaitStrategyT>>>
+  static std::shared_ptr<RingBuffer<E, SingleProducerSequencer<WaitStrategyT>, TracingT>>
   createSingleProducer(std::shared_ptr<EventFactory<E>> factory, int bufferSize,
                        WaitStrategyT &waitStrategy) {
     using Seq = SingleProducerSequencer<WaitStrategyT>;
     auto seq = std::make_unique<Seq>(bufferSize, waitStrategy);
-    return std::shared_ptr<RingBuffer<E, Seq>>(
-        new RingBuffer<E, Seq>(std::move(factory), std::move(seq)));
+    return std::shared_ptr<RingBuffer<E, Seq, TracingT>>(
+        new RingBuffer<E, Seq, TracingT>(std::move(factory), std::move(seq)));
+  }
+
+  // C++ addition: a single-producer ring whose producer never waits for
+  // consumers and overwrites what they have not read (see
+  // OverwritingSequencer.h).
+  template <typename WaitStrategyT>
+  static std::shared_ptr<RingBuffer<E, OverwritingSequencer<WaitStrategyT>, TracingT>>
+  createOverwriting(std::shared_ptr<EventFactory<E>> factory, int bufferSize,
+                    WaitStrategyT &waitStrategy) {
+    static_assert(std::is_trivially_copyable_v<E>,
+                  "events on an overwriting ring must be trivially copyable");
+    using Seq = OverwritingSequencer<WaitStrategyT>;
+    auto seq = std::make_unique<Seq>(bufferSize, waitStrategy);
+    return std::shared_ptr<RingBuffer<E, Seq, TracingT>>(
+        new RingBuffer<E, Seq, TracingT>(std::move(factory), std::move(seq)));
   }
 
   // DataProvider
@@ -93,15 +121,21 @@ public:
   // Java convenience overload: newBarrier() with no dependent sequences.
   auto newBarrier() { return newBarrier(nullptr, 0); }
 
+  // EventPoller has no way to tell an overwritten slot from a published one,
+  // so overwriting rings are consumed through a BatchEventProcessor only.
   std::shared_ptr<EventPoller<E, SequencerT>>
-  newPoller(Sequence *const *gatingSequences, int count) {
+  newPoller(Sequence *const *gatingSequences, int count)
+    requires(!OverwritingSequencerType<SequencerT>)
+  {
     auto pollerSequence = std::make_shared<Sequence>();
     return EventPoller<E, SequencerT>::newInstance(
         *this, sequencer(), std::move(pollerSequence),
         sequencer().cursorSequence(), gatingSequences, count);
   }
 
-  std::shared_ptr<EventPoller<E, SequencerT>> newPoller() {
+  std::shared_ptr<EventPoller<E, SequencerT>> newPoller()
+    requires(!OverwritingSequencerType<SequencerT>)
+  {
     return newPoller(nullptr, 0);
   }
 
@@ -110,12 +144,46 @@ public:
     return sequencer().hasAvailableCapacity(requiredCapacity);
   }
   int64_t remainingCapacity() { return sequencer().remainingCapacity(); }
-  int64_t next() { return sequencer().next(); }
-  int64_t next(int n) { return sequencer().next(n); }
-  int64_t tryNext() { return sequencer().tryNext(); }
-  int64_t tryNext(int n) { return sequencer().tryNext(n); }
-  void publish(int64_t sequence) { sequencer().publish(sequence); }
-  void publish(int64_t lo, int64_t hi) { sequencer().publish(lo, hi); }
+  int64_t next() { return traceClaim(sequencer().next(), 1); }
+  int64_t next(int n) { return traceClaim(sequencer().next(n), n); }
+  int64_t tryNext() { return traceClaim(sequencer().tryNext(), 1); }
+  int64_t tryNext(int n) { return traceClaim(sequencer().tryNext(n), n); }
+  // C++ addition: tryNext() returning std::nullopt instead of throwing
+  // InsufficientCapacityException when the ring is full.
+  std::optional<int64_t> tryClaim() { return tryClaim(1); }
+  std::optional<int64_t> tryClaim(int n) {
+    const std::optional<int64_t> hi = sequencer().tryClaim(n);
+    if constexpr (TracingT::kEnabled) {
+      if (hi) {
+        traceClaim(*hi, n);
+      }
+    }
+    return hi;
+  }
+  void publish(int64_t sequence) {
+    if constexpr (TracingT::kEnabled) {
+      tracing_.onPublish(sequence, sequence);
+    }
+    sequencer().publish(sequence);
+  }
+  void publish(int64_t lo, int64_t hi) {
+    if constexpr (TracingT::kEnabled) {
+      tracing_.onPublish(lo, hi);
+    }
+    sequencer().publish(lo, hi);
+  }
+
+  // C++ addition: scoped in-place claims that publish on destruction, so an
+  // exception between claim and publish cannot leave a gap (see ClaimedSlot.h).
+  ClaimedSlot<RingBuffer> claim() { return ClaimedSlot<RingBuffer>(*this, next()); }
+  ClaimedRange<RingBuffer> claim(int n) {
+    const int64_t hi = next(n);
+    return ClaimedRange<RingBuffer>(*this, hi - (n - 1), hi);
+  }
+
+  // The tracing policy, e.g. to attach a util::SequenceTracer before
+  // producers start.
+  TracingT &getTracing() { return tracing_; }
 
   // EventSink-like helpers
   void publishEvent(EventTranslator<E> &translator) {
@@ -125,10 +193,11 @@ public:
   }
 
   bool tryPublishEvent(EventTranslator<E> &translator) {
-    if (!hasAvailableCapacity(1)) {
+    const std::optional<int64_t> claimed = tryClaim();
+    if (!claimed) {
       return false;
     }
-    int64_t sequence = next();
+    const int64_t sequence = *claimed;
     translator.translateTo(get(sequence), sequence);
     publish(sequence);
     return true;
@@ -143,10 +212,11 @@ public:
 
   bool tryPublishEvent(EventTranslatorVararg<E> &translator,
                        const std::vector<void *> &args) {
-    if (!hasAvailableCapacity(1)) {
+    const std::optional<int64_t> claimed = tryClaim();
+    if (!claimed) {
       return false;
     }
-    int64_t sequence = next();
+    const int64_t sequence = *claimed;
     translator.translateTo(get(sequence), sequence, args);
     publish(sequence);
     return true;
@@ -161,9 +231,12 @@ public:
 
   template <typename A>
   bool tryPublishEvent(EventTranslatorOneArg<E, A> &translator, A arg0) {
-    if (!hasAvailableCapacity(1))
+    const std::optional<int64_t> claimed = tryClaim();
+    if (!claimed) {
       return false;
-    publishEvent(translator, arg0);
+    }
+    translator.translateTo(get(*claimed), *claimed, arg0);
+    publish(*claimed);
     return true;
   }
 
@@ -178,9 +251,12 @@ public:
   template <typename A, typename B>
   bool tryPublishEvent(EventTranslatorTwoArg<E, A, B> &translator, A arg0,
                        B arg1) {
-    if (!hasAvailableCapacity(1))
+    const std::optional<int64_t> claimed = tryClaim();
+    if (!claimed) {
       return false;
-    publishEvent(translator, arg0, arg1);
+    }
+    translator.translateTo(get(*claimed), *claimed, arg0, arg1);
+    publish(*claimed);
     return true;
   }
 
@@ -195,9 +271,121 @@ public:
   template <typename A, typename B, typename C>
   bool tryPublishEvent(EventTranslatorThreeArg<E, A, B, C> &translator, A arg0,
                        B arg1, C arg2) {
-    if (!hasAvailableCapacity(1))
+    const std::optional<int64_t> claimed = tryClaim();
+    if (!claimed) {
+      return false;
+    }
+    translator.translateTo(get(*claimed), *claimed, arg0, arg1, arg2);
+    publish(*claimed);
+    return true;
+  }
+
+  // C++ addition: callable translators. fn(event, sequence, args...) is
+  // inlined between claim and publish, so unlike EventTranslatorVararg there
+  // is no virtual call and no boxing of the arguments. As in Java, the slot
+  // is published even if fn throws.
+  template <typename F, typename... Args>
+    requires std::invocable<F &, E &, int64_t, Args &...>
+  void publishEvent(F &&fn, Args &&...args) {
+    const int64_t sequence = next();
+    translateAndPublish(fn, sequence, args...);
+  }
+
+  template <typename F, typename... Args>
+    requires std::invocable<F &, E &, int64_t, Args &...>
+  bool tryPublishEvent(F &&fn, Args &&...args) {
+    const std::optional<int64_t> claimed = tryClaim();
+    if (!claimed) {
       return false;
-    publishEvent(translator, arg0, arg1, arg2);
+    }
+    translateAndPublish(fn, *claimed, args...);
+    return true;
+  }
+
+  // One event per element: fn(event, sequence, args0[i], args1[i], ...).
+  // The argument ranges (spans, vectors, arrays) must have equal sizes; the
+  // whole batch is claimed and published at once.
+  template <typename F, std::ranges::random_access_range... Ranges>
+    requires(sizeof...(Ranges) > 0) &&
+            (std::ranges::sized_range<Ranges> && ...) &&
+            std::invocable<F &, E &, int64_t, std::ranges::range_reference_t<const Ranges>...>
+  void publishEvents(F &&fn, const Ranges &...args) {
+    const int batchSize = checkBatchArgs(args...);
+    if (batchSize == 0) {
+      return;
+    }
+    translateAndPublishBatch(fn, next(batchSize), batchSize, args...);
+  }
+
+  template <typename F, std::ranges::random_access_range... Ranges>
+    requires(sizeof...(Ranges) > 0) &&
+            (std::ranges::sized_range<Ranges> && ...) &&
+            std::invocable<F &, E &, int64_t, std::ranges::range_reference_t<const Ranges>...>
+  bool tryPublishEvents(F &&fn, const Ranges &...args) {
+    const int batchSize = checkBatchArgs(args...);
+    if (batchSize == 0) {
+      return true;
+    }
+    const std::optional<int64_t> claimed = tryClaim(batchSize);
+    if (!claimed) {
+      return false;
+    }
+    translateAndPublishBatch(fn, *claimed, batchSize, args...);
+    return true;
+  }
+
+  // C++ addition: one event per element of source, fn(event, sequence,
+  // element). Sources larger than the ring are published in chunks of at
+  // most getBufferSize() events, one claim/publish per chunk.
+  template <std::ranges::random_access_range Source, typename F>
+    requires std::ranges::sized_range<Source> &&
+             std::invocable<F &, E &, int64_t, std::ranges::range_reference_t<const Source>>
+  void publishEvents(const Source &source, F &&fn) {
+    const auto total = static_cast<size_t>(std::ranges::size(source));
+    const auto first = std::ranges::begin(source);
+    for (size_t offset = 0; offset < total;) {
+      const int batchSize = chunkSize(total - offset);
+      const auto chunkBegin = first + static_cast<std::ptrdiff_t>(offset);
+      translateAndPublishBatch(fn, next(batchSize), batchSize,
+                               std::ranges::subrange(chunkBegin, chunkBegin + batchSize));
+      offset += static_cast<size_t>(batchSize);
+    }
+  }
+
+  // C++ addition: copy already-built events straight into the ring with at
+  // most two memcpy calls per chunk (one on each side of the wrap point).
+  // Chunked like publishEvents(source, fn).
+  void publishRaw(std::span<const E> events) {
+    static_assert(std::is_trivially_copyable_v<E>, "publishRaw requires a trivially copyable event type");
+    for (size_t offset = 0; offset < events.size();) {
+      const int batchSize = chunkSize(events.size() - offset);
+      const int64_t hi = next(batchSize);
+      const int64_t lo = hi - (batchSize - 1);
+      copyIn(lo, events.subspan(offset, static_cast<size_t>(batchSize)));
+      publish(lo, hi);
+      offset += static_cast<size_t>(batchSize);
+    }
+  }
+
+  // All-or-nothing: false (nothing published) if the whole span does not fit
+  // in the free capacity.
+  bool tryPublishRaw(std::span<const E> events) {
+    static_assert(std::is_trivially_copyable_v<E>, "publishRaw requires a trivially copyable event type");
+    if (events.empty()) {
+      return true;
+    }
+    if (events.size() > static_cast<size_t>(bufferSize_)) {
+      throw std::invalid_argument("Too many events to publish in one batch");
+    }
+    const int batchSize = static_cast<int>(events.size());
+    const std::optional<int64_t> claimed = tryClaim(batchSize);
+    if (!claimed) {
+      return false;
+    }
+    const int64_t hi = *claimed;
+    const int64_t lo = hi - (batchSize - 1);
+    copyIn(lo, events);
+    publish(lo, hi);
     return true;
   }
 
@@ -210,20 +398,7 @@ public:
     if (batchSize == 0) {
       return;
     }
-    int64_t finalSequence = next(batchSize);
-    int64_t initialSequence = finalSequence - (batchSize - 1);
-    try {
-      for (int i = 0; i < batchSize; ++i) {
-        auto *tr = translators[static_cast<size_t>(batchStartsAt + i)];
-        if (tr) {
-          tr->translateTo(get(initialSequence + i), initialSequence + i);
-        }
-      }
-    } catch (...) {
-      publish(initialSequence, finalSequence);
-      throw;
-    }
-    publish(initialSequence, finalSequence);
+    translateAndPublishBatch(translators, batchStartsAt, batchSize, next(batchSize));
   }
 
   bool tryPublishEvents(std::vector<EventTranslator<E> *> &translators) {
@@ -236,10 +411,11 @@ public:
     if (batchSize == 0) {
       return true;
     }
-    if (!hasAvailableCapacity(batchSize)) {
+    const std::optional<int64_t> claimed = tryClaim(batchSize);
+    if (!claimed) {
       return false;
     }
-    publishEvents(translators, batchStartsAt, batchSize);
+    translateAndPublishBatch(translators, batchStartsAt, batchSize, *claimed);
     return true;
   }
 
@@ -319,6 +495,81 @@ private:
   std::optional<SequencerT> sequencerValue_;
   std::unique_ptr<SequencerT> sequencerOwner_;
   bool usingValue_;
+  [[no_unique_address]] TracingT tracing_;
+
+  template <typename F, typename... Args>
+  void translateAndPublish(F &fn, int64_t sequence, Args &...args) {
+    try {
+      fn(get(sequence), sequence, args...);
+    } catch (...) {
+      publish(sequence);
+      throw;
+    }
+    publish(sequence);
+  }
+
+  void translateAndPublishBatch(std::vector<EventTranslator<E> *> &translators,
+                                int batchStartsAt, int batchSize,
+                                int64_t finalSequence) {
+    int64_t initialSequence = finalSequence - (batchSize - 1);
+    try {
+      for (int i = 0; i < batchSize; ++i) {
+        auto *tr = translators[static_cast<size_t>(batchStartsAt + i)];
+        if (tr) {
+          tr->translateTo(get(initialSequence + i), initialSequence + i);
+        }
+      }
+    } catch (...) {
+      publish(initialSequence, finalSequence);
+      throw;
+    }
+    publish(initialSequence, finalSequence);
+  }
+
+  template <typename Range, typename... Ranges>
+  static int checkBatchArgs(const Range &first, const Ranges &...rest) {
+    const auto size = std::ranges::size(first);
+    if (((std::ranges::size(rest) != size) || ...)) {
+      throw std::invalid_argument("All argument ranges must have the same size");
+    }
+    return static_cast<int>(size);
+  }
+
+  template <typename F, typename... Ranges>
+  void translateAndPublishBatch(F &fn, int64_t finalSequence, int batchSize,
+                                const Ranges &...args) {
+    const int64_t initialSequence = finalSequence - (batchSize - 1);
+    try {
+      for (int i = 0; i < batchSize; ++i) {
+        const int64_t sequence = initialSequence + i;
+        fn(get(sequence), sequence, std::ranges::begin(args)[i]...);
+      }
+    } catch (...) {
+      publish(initialSequence, finalSequence);
+      throw;
+    }
+    publish(initialSequence, finalSequence);
+  }
+
+  int chunkSize(size_t remaining) const {
+    return remaining < static_cast<size_t>(bufferSize_) ? static_cast<int>(remaining) : bufferSize_;
+  }
+
+  void copyIn(int64_t lo, std::span<const E> events) {
+    const size_t index = static_cast<size_t>(lo & indexMask_);
+    const size_t firstPart = (std::min)(events.size(), static_cast<size_t>(bufferSize_) - index);
+    std::memcpy(&entries_[BUFFER_PAD + index], events.data(), firstPart * sizeof(E));
+    if (firstPart < events.size()) {
+      std::memcpy(&entries_[BUFFER_PAD], events.data() + firstPart, (events.size() - firstPart) * sizeof(E));
+    }
+  }
+
+  int64_t traceClaim(int64_t hi, int n) {
+    if constexpr (TracingT::kEnabled) {
+      tracing_.onClaim(hi - n + 1, hi);
+    }
+    return hi;
+  }
 
   SequencerT &sequencer() {
     return usingValue_ ? *sequencerValue_ : *sequencerOwner_;
@@ -329,12 +580,16 @@ private:
 };
 
 // Type aliases to simplify API usage (avoid explicit Sequencer type specification)
-template <typename E, typename WaitStrategyT>
+template <typename E, typename WaitStrategyT, typename TracingT = NoOpRingBufferTracing>
 using SingleProducerRingBuffer =
-    RingBuffer<E, SingleProducerSequencer<WaitStrategyT>>;
+    RingBuffer<E, SingleProducerSequencer<WaitStrategyT>, TracingT>;
 
-template <typename E, typename WaitStrategyT>
+template <typename E, typename WaitStrategyT, typename TracingT = NoOpRingBufferTracing>
 using MultiProducerRingBuffer =
-    RingBuffer<E, MultiProducerSequencer<WaitStrategyT>>;
+    RingBuffer<E, MultiProducerSequencer<WaitStrategyT>, TracingT>;
+
+template <typename E, typename WaitStrategyT, typename TracingT = NoOpRingBufferTracing>
+using OverwritingRingBuffer =
+    RingBuffer<E, OverwritingSequencer<WaitStrategyT>, TracingT>;
 
 } // namespace disruptor
@@ -0,0 +1,51 @@
+#pragma once
+// Opt-in claim/publish tracing policies for RingBuffer.
+//
+// RingBuffer takes the policy as its third template parameter and only calls
+// into it under `if constexpr (TracingT::kEnabled)`, so the default
+// NoOpRingBufferTracing leaves next/tryNext/publish unchanged.
+//
+// Required API for a tracing policy `P`:
+//   static constexpr bool P::kEnabled;
+//   void P::onClaim(int64_t lo, int64_t hi);
+//   void P::onPublish(int64_t lo, int64_t hi);
+
+#include "util/SequenceTracer.h"
+
+#include <cstdint>
+
+namespace disruptor {
+
+struct NoOpRingBufferTracing final {
+  static constexpr bool kEnabled = false;
+
+  void onClaim(int64_t /*lo*/, int64_t /*hi*/) noexcept {}
+  void onPublish(int64_t /*lo*/, int64_t /*hi*/) noexcept {}
+};
+
+// Stamps the claim and publish columns of a util::SequenceTracer for sampled
+// sequences. Attach before producers start:
+//   ringBuffer->getTracing().attach(tracer);
+class RingBufferSequenceTracing final {
+public:
+  static constexpr bool kEnabled = true;
+
+  void attach(util::SequenceTracer& tracer) noexcept { tracer_ = &tracer; }
+
+  void onClaim(int64_t lo, int64_t hi) noexcept {
+    if (tracer_ != nullptr) {
+      tracer_->onClaim(lo, hi);
+    }
+  }
+
+  void onPublish(int64_t lo, int64_t hi) noexcept {
+    if (tracer_ != nullptr) {
+      tracer_->onPublish(lo, hi);
+    }
+  }
+
+private:
+  util::SequenceTracer* tracer_ = nullptr;
+};
+
+} // namespace disruptor
@@ -14,6 +14,7 @@
 //   int64_t next(int n);
 //   int64_t tryNext();
 //   int64_t tryNext(int n);
+//   std::optional<int64_t> tryClaim(int n);   (C++: tryNext without throwing)
 //   void publish(int64_t sequence);
 //   void publish(int64_t lo, int64_t hi);
 //   void addGatingSequences(Sequence* const* gatingSequences, int count);
@@ -22,7 +23,12 @@
 //   newBarrier(...); (via concrete type) int64_t getMinimumSequence(); int64_t
 //   getHighestPublishedSequence(int64_t nextSequence, int64_t
 //   availableSequence);
+//
+// Sequencers that overwrite unconsumed events instead of gating the producer
+// (OverwritingSequencer) also provide isIntact() and getOldestIntactSequence();
+// see OverwritingSequencerType below.
 
+#include <concepts>
 #include <cstdint>
 
 namespace disruptor {
@@ -36,4 +42,12 @@ struct Sequencer {
 inline constexpr int64_t SEQUENCER_INITIAL_CURSOR_VALUE =
     Sequencer::INITIAL_CURSOR_VALUE;
 
+// C++ addition: a sequencer whose producer may lap consumers. Consumers must
+// check each event with isIntact(sequence) and skip overwritten ones.
+template <typename S>
+concept OverwritingSequencerType = requires(const S &sequencer, int64_t sequence) {
+  { sequencer.isIntact(sequence) } -> std::same_as<bool>;
+  { sequencer.getOldestIntactSequence() } -> std::same_as<int64_t>;
+};
+
 } // namespace disruptor
@@ -14,6 +14,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 #include <unordered_map>
@@ -96,11 +97,19 @@ public:
       this->cursor_.setVolatile(nextValue); // StoreLoad fence
 
       int64_t minSequence;
+      int64_t waitStartNanos = 0;
       while (wrapPoint > (minSequence = minimumSequence(nextValue))) {
+        if (waitStartNanos == 0) {
+          waitStartNanos = disruptor::util::Util::nanoTime();
+        }
         sp_wrap_wait_loops().fetch_add(1, std::memory_order_relaxed);
         // Java: LockSupport.parkNanos(1L)
         std::this_thread::yield();
       }
+      if (waitStartNanos != 0) {
+        this->recordWrapWait(disruptor::util::Util::nanoTime() -
+                             waitStartNanos);
+      }
 
       this->cachedValue_ = minSequence;
     }
@@ -112,12 +121,24 @@ public:
   int64_t tryNext() { return tryNext(1); }
 
   int64_t tryNext(int n) {
+    const std::optional<int64_t> next = tryClaim(n);
+    if (!next) {
+      throw InsufficientCapacityException::INSTANCE();
+    }
+    return *next;
+  }
+
+  // C++ addition: tryNext() that reports a full ring as std::nullopt instead
+  // of throwing, for callers that shed load on rejection.
+  std::optional<int64_t> tryClaim() { return tryClaim(1); }
+
+  std::optional<int64_t> tryClaim(int n) {
     if (n < 1) {
       throw std::invalid_argument("n must be > 0");
     }
 
     if (!hasAvailableCapacity(n, true)) {
-      throw InsufficientCapacityException::INSTANCE();
+      return std::nullopt;
     }
 
     this->nextValue_ += n;
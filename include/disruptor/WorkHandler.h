@@ -0,0 +1,28 @@
+#pragma once
+// Port of com.lmax.disruptor.WorkHandler from Disruptor 3.x (removed in 4.0,
+// so there is no copy under reference/).
+//
+// Callback interface for WorkProcessor: each event is handed to exactly one
+// WorkHandler of a WorkerPool. Java's LifecycleAware and TimeoutHandler are
+// folded in as virtual no-op hooks, as EventHandlerBase does.
+
+#include "EventHandlerIdentity.h"
+
+#include <cstdint>
+
+namespace disruptor {
+
+template <typename T>
+class WorkHandler : public EventHandlerIdentity {
+public:
+  ~WorkHandler() override = default;
+
+  // Java throws Exception; in C++ implementations may throw exceptions.
+  virtual void onEvent(T& event) = 0;
+
+  virtual void onStart() {}
+  virtual void onShutdown() {}
+  virtual void onTimeout(int64_t /*sequence*/) {}
+};
+
+} // namespace disruptor
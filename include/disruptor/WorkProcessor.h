@@ -0,0 +1,153 @@
+#pragma once
+// Port of com.lmax.disruptor.WorkProcessor from Disruptor 3.x (removed in 4.0,
+// so there is no copy under reference/).
+// C++ addition: maxClaimBatch > 1 claims up to that many published sequences
+// with one CAS; 1 is the Java behaviour.
+
+#include "AlertException.h"
+#include "DataProvider.h"
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "TimeoutException.h"
+#include "WorkHandler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace disruptor {
+
+template <typename T, typename BarrierT>
+class WorkProcessor final : public EventProcessor {
+public:
+  WorkProcessor(DataProvider<T>& dataProvider,
+                BarrierT& sequenceBarrier,
+                WorkHandler<T>& workHandler,
+                ExceptionHandler<T>& exceptionHandler,
+                Sequence& workSequence,
+                int maxClaimBatch = 1)
+      : running_(false),
+        sequence_(SEQUENCER_INITIAL_CURSOR_VALUE),
+        dataProvider_(&dataProvider),
+        sequenceBarrier_(&sequenceBarrier),
+        workHandler_(&workHandler),
+        exceptionHandler_(&exceptionHandler),
+        workSequence_(&workSequence),
+        maxClaimBatch_(maxClaimBatch) {
+    if (maxClaimBatch < 1) {
+      throw std::invalid_argument("maxClaimBatch must be greater than 0");
+    }
+  }
+
+  Sequence& getSequence() override { return sequence_; }
+
+  void halt() override {
+    running_.store(false, std::memory_order_release);
+    sequenceBarrier_->alert();
+  }
+
+  bool isRunning() override { return running_.load(std::memory_order_acquire); }
+
+  void run() override {
+    bool expected = false;
+    if (!running_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      throw std::runtime_error("Thread is already running");
+    }
+    sequenceBarrier_->clearAlert();
+
+    notifyStart();
+
+    bool processedSequence = true;
+    int64_t cachedAvailableSequence = (std::numeric_limits<int64_t>::min)();
+    int64_t nextSequence = sequence_.get();
+    int64_t endOfClaim = nextSequence;
+    T* event = nullptr;
+    while (true) {
+      try {
+        // If the previous sequence was processed take the next one from the
+        // current claim, or claim more from the shared work sequence.
+        if (processedSequence) {
+          processedSequence = false;
+          if (nextSequence < endOfClaim) {
+            ++nextSequence;
+          } else {
+            int64_t current;
+            do {
+              current = workSequence_->get();
+              nextSequence = current + 1;
+              sequence_.set(current);
+              endOfClaim = (std::max)(nextSequence,
+                                      (std::min)(current + maxClaimBatch_, cachedAvailableSequence));
+            } while (!workSequence_->compareAndSet(current, endOfClaim));
+          }
+        }
+
+        if (cachedAvailableSequence >= nextSequence) {
+          event = &dataProvider_->get(nextSequence);
+          workHandler_->onEvent(*event);
+          processedSequence = true;
+        } else {
+          cachedAvailableSequence = sequenceBarrier_->waitFor(nextSequence);
+        }
+      } catch (const TimeoutException&) {
+        notifyTimeout(sequence_.get());
+      } catch (const AlertException&) {
+        if (!running_.load(std::memory_order_acquire)) {
+          break;
+        }
+      } catch (const std::exception& ex) {
+        // handle, mark as processed, unless the exception handler threw an exception
+        try {
+          exceptionHandler_->handleEventException(ex, nextSequence, event);
+        } catch (...) {
+          running_.store(false, std::memory_order_release);
+          break;
+        }
+        processedSequence = true;
+      }
+    }
+
+    notifyShutdown();
+    running_.store(false, std::memory_order_release);
+  }
+
+private:
+  std::atomic<bool> running_;
+  Sequence sequence_;
+  DataProvider<T>* dataProvider_;
+  BarrierT* sequenceBarrier_;
+  WorkHandler<T>* workHandler_;
+  ExceptionHandler<T>* exceptionHandler_;
+  Sequence* workSequence_;
+  int maxClaimBatch_;
+
+  void notifyTimeout(int64_t availableSequence) {
+    try {
+      workHandler_->onTimeout(availableSequence);
+    } catch (const std::exception& e) {
+      exceptionHandler_->handleEventException(e, availableSequence, nullptr);
+    }
+  }
+
+  void notifyStart() {
+    try {
+      workHandler_->onStart();
+    } catch (const std::exception& ex) {
+      exceptionHandler_->handleOnStartException(ex);
+    }
+  }
+
+  void notifyShutdown() {
+    try {
+      workHandler_->onShutdown();
+    } catch (const std::exception& ex) {
+      exceptionHandler_->handleOnShutdownException(ex);
+    }
+  }
+};
+
+} // namespace disruptor
@@ -0,0 +1,140 @@
+#pragma once
+// Port of com.lmax.disruptor.WorkerPool from Disruptor 3.x (removed in 4.0,
+// so there is no copy under reference/).
+//
+// A pool of WorkProcessors that share one work sequence, so each event is
+// handled by exactly one WorkHandler. Java runs the processors on an
+// Executor; here start() creates one thread per worker via a ThreadFactory
+// and join() waits for them after halt().
+
+#include "ExceptionHandler.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "WorkHandler.h"
+#include "WorkProcessor.h"
+#include "dsl/ThreadFactory.h"
+#include "util/Util.h"
+
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace disruptor {
+
+template <typename T, typename RingBufferT, typename BarrierT>
+class WorkerPool final {
+public:
+  using WorkProcessorT = WorkProcessor<T, BarrierT>;
+
+  WorkerPool(RingBufferT& ringBuffer,
+             BarrierT& sequenceBarrier,
+             ExceptionHandler<T>& exceptionHandler,
+             WorkHandler<T>* const* workHandlers,
+             int count,
+             int maxClaimBatch = 1)
+      : started_(false), workSequence_(SEQUENCER_INITIAL_CURSOR_VALUE), ringBuffer_(&ringBuffer) {
+    if (count < 1) {
+      throw std::invalid_argument("WorkerPool requires at least one WorkHandler");
+    }
+    workProcessors_.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+      workProcessors_.push_back(std::make_unique<WorkProcessorT>(
+          ringBuffer, sequenceBarrier, *workHandlers[i], exceptionHandler, workSequence_, maxClaimBatch));
+    }
+  }
+
+  ~WorkerPool() {
+    if (isRunning()) {
+      halt();
+    }
+    join();
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  // Java: Sequence[] getWorkerSequences() - the worker sequences plus the
+  // shared work sequence, all of which must gate the ring buffer.
+  std::vector<Sequence*> getWorkerSequences() {
+    std::vector<Sequence*> sequences;
+    sequences.reserve(workProcessors_.size() + 1);
+    for (auto& processor : workProcessors_) {
+      sequences.push_back(&processor->getSequence());
+    }
+    sequences.push_back(&workSequence_);
+    return sequences;
+  }
+
+  int getWorkerCount() const { return static_cast<int>(workProcessors_.size()); }
+
+  // Starts one thread per worker from the ring buffer's current cursor.
+  // startupLatch (if any) is counted down once, after every thread is created.
+  RingBufferT& start(dsl::ThreadFactory& threadFactory, std::latch* startupLatch = nullptr) {
+    bool expected = false;
+    if (!started_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      throw std::runtime_error("WorkerPool has already been started and cannot be restarted until halted.");
+    }
+
+    const int64_t cursor = ringBuffer_->getCursor();
+    workSequence_.set(cursor);
+
+    try {
+      for (auto& processor : workProcessors_) {
+        processor->getSequence().set(cursor);
+        WorkProcessorT* p = processor.get();
+        threads_.push_back(threadFactory.newThread([p] { p->run(); }));
+      }
+    } catch (...) {
+      if (startupLatch != nullptr) {
+        startupLatch->count_down();
+      }
+      throw;
+    }
+    if (startupLatch != nullptr) {
+      startupLatch->count_down();
+    }
+    return *ringBuffer_;
+  }
+
+  // Wait for the ring buffer to drain of published events, then halt the workers.
+  void drainAndHalt() {
+    const std::vector<Sequence*> workerSequences = getWorkerSequences();
+    while (ringBuffer_->getCursor() > util::Util::getMinimumSequence(workerSequences)) {
+      std::this_thread::yield();
+    }
+
+    halt();
+  }
+
+  // Halt all workers immediately at the end of their current cycle.
+  void halt() {
+    for (auto& processor : workProcessors_) {
+      processor->halt();
+    }
+    started_.store(false, std::memory_order_release);
+  }
+
+  void join() {
+    for (auto& thread : threads_) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+    threads_.clear();
+  }
+
+  bool isRunning() const { return started_.load(std::memory_order_acquire); }
+
+private:
+  std::atomic<bool> started_;
+  Sequence workSequence_;
+  RingBufferT* ringBuffer_;
+  std::vector<std::unique_ptr<WorkProcessorT>> workProcessors_;
+  std::vector<std::thread> threads_;
+};
+
+} // namespace disruptor
@@ -25,6 +25,9 @@ public:
   virtual void halt() = 0;
   virtual void join() = 0;
   virtual void markAsUsedInBarrier() = 0;
+  // C++ addition: undoes markAsUsedInBarrier() once the last handler attached
+  // behind this consumer while running has been removed.
+  virtual void markAsEndOfChain() = 0;
   virtual bool isRunning() = 0;
 };
 
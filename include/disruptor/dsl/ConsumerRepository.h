@@ -9,6 +9,7 @@
 #include "ConsumerInfo.h"
 #include "EventProcessorInfo.h"
 #include "ThreadFactory.h"
+#include "WorkerPoolInfo.h"
 
 #include <latch>
 #include <memory>
@@ -37,6 +38,19 @@ public:
     consumerInfos_.push_back(std::move(consumerInfo));
   }
 
+  // Java 3.x: add(WorkerPool<T> workerPool, SequenceBarrier sequenceBarrier)
+  template <typename WorkerPoolT>
+  void add(WorkerPoolT &workerPool, BarrierPtrT barrier) {
+    auto workerPoolInfo =
+        std::make_shared<WorkerPoolInfo<BarrierPtrT, WorkerPoolT>>(workerPool,
+                                                                   barrier);
+    Sequence *const *sequences = workerPoolInfo->getSequences();
+    for (int i = 0; i < workerPoolInfo->getSequenceCount(); ++i) {
+      eventProcessorInfoBySequence_[sequences[i]] = workerPoolInfo;
+    }
+    consumerInfos_.push_back(std::move(workerPoolInfo));
+  }
+
   void startAll(ThreadFactory &threadFactory,
                 std::latch *startupLatch = nullptr) {
     for (auto &c : consumerInfos_) {
@@ -76,6 +90,21 @@ public:
     return false;
   }
 
+  // Visits every consumer sequence in registration order:
+  // visitor(const Sequence&, bool endOfChain, bool running).
+  // Used by Disruptor::getMetrics(); only reads the sequences.
+  template <typename Visitor> void forEachSequence(Visitor &&visitor) {
+    for (auto &consumerInfo : consumerInfos_) {
+      Sequence *const *sequences = consumerInfo->getSequences();
+      const int count = consumerInfo->getSequenceCount();
+      const bool endOfChain = consumerInfo->isEndOfChain();
+      const bool running = consumerInfo->isRunning();
+      for (int i = 0; i < count; ++i) {
+        visitor(*sequences[i], endOfChain, running);
+      }
+    }
+  }
+
   EventProcessor &getEventProcessorFor(EventHandlerIdentity &handlerIdentity) {
     auto *info = getEventProcessorInfo(handlerIdentity);
     if (info == nullptr) {
@@ -100,11 +129,78 @@ public:
     }
   }
 
+  // C++ addition: as above, for a consumer attached while running. Only
+  // consumers that this unmarks (or that an earlier attach unmarked) are
+  // tracked; remove(dependent) marks them end-of-chain again once nothing
+  // attached later still waits on them.
+  void unMarkEventProcessorsAsEndOfChain(Sequence &dependent,
+                                         Sequence *const *barrierEventProcessors,
+                                         int count) {
+    std::vector<Sequence *> &upstream = runtimeUpstreamByDependent_[&dependent];
+    for (int i = 0; i < count; ++i) {
+      Sequence *sequence = barrierEventProcessors[i];
+      auto *info = getEventProcessorInfo(*sequence);
+      if (info == nullptr) {
+        continue;
+      }
+      auto it = runtimeDependentCounts_.find(sequence);
+      if (it != runtimeDependentCounts_.end()) {
+        ++it->second;
+      } else if (info->isEndOfChain()) {
+        runtimeDependentCounts_[sequence] = 1;
+        info->markAsUsedInBarrier();
+      } else {
+        continue; // a dependency fixed before start
+      }
+      upstream.push_back(sequence);
+    }
+  }
+
   BarrierPtrT getBarrierFor(EventHandlerIdentity &handlerIdentity) {
     auto *consumerInfo = getEventProcessorInfo(handlerIdentity);
     return consumerInfo != nullptr ? consumerInfo->getBarrier() : BarrierPtrT{};
   }
 
+  // C++ addition for handlers attached/detached while running (see
+  // Disruptor::addHandlerWhileRunning). nullptr if the handler is unknown.
+  std::shared_ptr<EventProcessorInfo<BarrierPtrT>>
+  getEventProcessorInfoFor(EventHandlerIdentity &handlerIdentity) {
+    auto it = eventProcessorInfoByEventHandler_.find(&handlerIdentity);
+    return it == eventProcessorInfoByEventHandler_.end() ? nullptr : it->second;
+  }
+
+  std::vector<std::shared_ptr<ConsumerInfo<BarrierPtrT>>> getConsumerInfos() const {
+    return consumerInfos_;
+  }
+
+  // Forget a handler's consumer; it must already be halted and joined.
+  void remove(EventHandlerIdentity &handlerIdentity) {
+    auto it = eventProcessorInfoByEventHandler_.find(&handlerIdentity);
+    if (it == eventProcessorInfoByEventHandler_.end()) {
+      return;
+    }
+    const InfoPtr consumerInfo = it->second;
+    Sequence *sequence = &consumerInfo->getEventProcessor().getSequence();
+    eventProcessorInfoByEventHandler_.erase(it);
+    eventProcessorInfoBySequence_.erase(sequence);
+    std::erase(consumerInfos_, consumerInfo);
+
+    auto upstream = runtimeUpstreamByDependent_.find(sequence);
+    if (upstream == runtimeUpstreamByDependent_.end()) {
+      return;
+    }
+    for (Sequence *upstreamSequence : upstream->second) {
+      auto count = runtimeDependentCounts_.find(upstreamSequence);
+      if (--count->second == 0) {
+        runtimeDependentCounts_.erase(count);
+        if (auto *info = getEventProcessorInfo(*upstreamSequence)) {
+          info->markAsEndOfChain();
+        }
+      }
+    }
+    runtimeUpstreamByDependent_.erase(upstream);
+  }
+
 private:
   using InfoPtr = std::shared_ptr<EventProcessorInfo<BarrierPtrT>>;
 
@@ -127,6 +223,11 @@ private:
   std::unordered_map<Sequence *, std::shared_ptr<ConsumerInfo<BarrierPtrT>>>
       eventProcessorInfoBySequence_;
   std::vector<std::shared_ptr<ConsumerInfo<BarrierPtrT>>> consumerInfos_;
+  // Dependencies added while running: what each attached consumer waits on,
+  // and how many attached consumers wait on each upstream sequence.
+  std::unordered_map<Sequence *, std::vector<Sequence *>>
+      runtimeUpstreamByDependent_;
+  std::unordered_map<Sequence *, int> runtimeDependentCounts_;
 };
 
 } // namespace disruptor::dsl
@@ -14,13 +14,17 @@
 #include "../EventTranslator.h"
 #include "../EventTranslatorOneArg.h"
 #include "../ExceptionHandler.h"
+#include "../PartitionedEventProcessor.h"
 #include "../RingBuffer.h"
 #include "../Sequence.h"
 #include "../TimeoutException.h"
 #include "../WaitStrategy.h"
+#include "../WorkHandler.h"
+#include "../WorkerPool.h"
 #include "../util/Util.h"
 
 #include "ConsumerRepository.h"
+#include "DisruptorMetrics.h"
 #include "EventHandlerGroup.h"
 #include "EventProcessorFactory.h"
 #include "ExceptionHandlerSetting.h"
@@ -28,13 +32,18 @@
 #include "ProducerType.h"
 #include "ThreadFactory.h"
 
+#include <algorithm>
 #include <atomic>
+#include <concepts>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -50,7 +59,7 @@ public:
     try {
       halt();
       // After halt(), we still need to join threads to avoid std::terminate
-      consumerRepository_.joinAll();
+      join();
     } catch (...) {
       // Best-effort teardown; never throw from destructor.
     }
@@ -112,6 +121,53 @@ public:
         static_cast<int>(sequences.size()));
   }
 
+  // Shard events across handlers by key (see PartitionedEventProcessor.h).
+  // Each handler gets its own thread and sees, in ring order, only the events
+  // whose keyFn(event) hashes to it.
+  template <typename KeyFn, typename... Handlers>
+    requires(sizeof...(Handlers) > 0 &&
+             (std::derived_from<Handlers, ::disruptor::EventHandlerBase<T>> &&
+              ...))
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithPartitioned(KeyFn keyFn, Handlers &...handlers) {
+    ::disruptor::EventHandlerBase<T> *list[] = {&handlers...};
+    return handleEventsWithPartitioned(std::move(keyFn), list,
+                                       static_cast<int>(sizeof...(Handlers)));
+  }
+
+  // Runtime partition count (e.g. one handler per order book).
+  template <typename KeyFn>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithPartitioned(KeyFn keyFn,
+                              ::disruptor::EventHandlerBase<T> *const *handlers,
+                              int count) {
+    Sequence *none[0]{};
+    return createPartitionedEventProcessors(none, 0, std::move(keyFn),
+                                            handlers, count);
+  }
+
+  // Java 3.x: handleEventsWithWorkerPool(WorkHandler<T>... workHandlers).
+  // Each event is processed by exactly one of the handlers.
+  template <typename... WorkHandlers>
+    requires(sizeof...(WorkHandlers) > 0 &&
+             (std::derived_from<WorkHandlers, ::disruptor::WorkHandler<T>> &&
+              ...))
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithWorkerPool(WorkHandlers &...workHandlers) {
+    ::disruptor::WorkHandler<T> *list[] = {&workHandlers...};
+    return handleEventsWithWorkerPool(
+        list, static_cast<int>(sizeof...(WorkHandlers)));
+  }
+
+  // maxClaimBatch > 1 lets each worker claim several sequences per CAS (see
+  // WorkProcessor.h).
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithWorkerPool(::disruptor::WorkHandler<T> *const *workHandlers,
+                             int count, int maxClaimBatch = 1) {
+    Sequence *none[0]{};
+    return createWorkerPool(none, 0, workHandlers, count, maxClaimBatch);
+  }
+
   // Exception handling
   void handleExceptionsWith(ExceptionHandler<T> &exceptionHandler) {
     // Release ownership of the default wrapper, switch to external handler
@@ -173,15 +229,142 @@ public:
     ringBuffer_->publishEvent(translator, arg0);
   }
 
+  // Callable translator, see RingBuffer::publishEvent(F&&, Args&&...).
+  template <typename F, typename... Args>
+    requires std::invocable<F &, T &, int64_t, Args &...>
+  void publishEvent(F &&fn, Args &&...args) {
+    ringBuffer_->publishEvent(fn, args...);
+  }
+
+  // Non-throwing publish: false, with nothing claimed, if the ring is full.
+  bool tryPublishEvent(EventTranslator<T> &translator) {
+    return ringBuffer_->tryPublishEvent(translator);
+  }
+
+  template <typename F, typename... Args>
+    requires std::invocable<F &, T &, int64_t, Args &...>
+  bool tryPublishEvent(F &&fn, Args &&...args) {
+    return ringBuffer_->tryPublishEvent(fn, args...);
+  }
+
   // Start/stop lifecycle
   std::shared_ptr<RingBufferT> start(std::latch *startupLatch = nullptr) {
     checkOnlyStartedOnce();
+    std::lock_guard<std::mutex> lock(consumersMutex_);
     consumerRepository_.startAll(threadFactory_, startupLatch);
     return ringBuffer_;
   }
 
-  void halt() { consumerRepository_.haltAll(); }
-  void join() { consumerRepository_.joinAll(); }
+  void halt() {
+    std::lock_guard<std::mutex> lock(consumersMutex_);
+    consumerRepository_.haltAll();
+  }
+  void join() {
+    // Join outside the lock: a handler may call halt() while shutting down.
+    std::vector<std::shared_ptr<ConsumerInfo<BarrierPtr>>> consumers;
+    {
+      std::lock_guard<std::mutex> lock(consumersMutex_);
+      consumers = consumerRepository_.getConsumerInfos();
+    }
+    for (auto &consumer : consumers) {
+      consumer->join();
+    }
+  }
+
+  // C++ addition: attach a handler to a started disruptor. Its sequence
+  // starts at the current cursor, so it sees events published from now on,
+  // and gates the ring buffer before its thread (from the ThreadFactory)
+  // starts. `after` optionally places it behind handlers already attached.
+  void addHandlerWhileRunning(::disruptor::EventHandlerBase<T> &handler,
+                              EventHandlerIdentity *const *after = nullptr,
+                              int afterCount = 0) {
+    if (!hasStarted()) {
+      throw std::runtime_error(
+          "Disruptor has not been started, use handleEventsWith instead.");
+    }
+
+    std::lock_guard<std::mutex> lock(consumersMutex_);
+    if (consumerRepository_.getEventProcessorInfoFor(handler) != nullptr) {
+      throw std::invalid_argument(
+          "The event handler is already processing events.");
+    }
+    std::vector<Sequence *> barrierSequences;
+    barrierSequences.reserve(static_cast<size_t>(afterCount));
+    for (int i = 0; i < afterCount; ++i) {
+      barrierSequences.push_back(&consumerRepository_.getSequenceFor(*after[i]));
+    }
+
+    auto barrier = ringBuffer_->newBarrier(barrierSequences.data(), afterCount);
+    auto processor = std::make_shared<BatchEventProcessor<T, BarrierT>>(
+        *ringBuffer_, *barrier, handler, std::numeric_limits<int>::max(),
+        nullptr);
+    processor->setExceptionHandler(getExceptionHandler());
+    // Sets the sequence to the cursor as it registers it.
+    ringBuffer_->addGatingSequences(processor->getSequence());
+
+    ownedBarriers_.push_back(barrier);
+    ownedProcessors_.push_back(processor);
+    consumerRepository_.add(*processor, handler, barrier);
+    consumerRepository_.unMarkEventProcessorsAsEndOfChain(
+        processor->getSequence(), barrierSequences.data(), afterCount);
+    consumerRepository_.getEventProcessorInfoFor(handler)->start(threadFactory_);
+  }
+
+  // C++ addition: detach a handler while the disruptor runs. Waits until it
+  // has processed everything published before the call, then halts it,
+  // joins its thread and stops gating the ring buffer. Handlers that other
+  // handlers wait on cannot be removed; handlers that only the removed one
+  // waited on become end-of-chain again. Partition handlers cannot be
+  // removed. Returns false if the handler is not attached.
+  bool removeHandlerWhileRunning(EventHandlerIdentity &handler) {
+    std::shared_ptr<EventProcessorInfo<BarrierPtr>> consumerInfo;
+    {
+      std::lock_guard<std::mutex> lock(consumersMutex_);
+      consumerInfo = consumerRepository_.getEventProcessorInfoFor(handler);
+      if (consumerInfo == nullptr) {
+        return false;
+      }
+      checkRemovable(*consumerInfo);
+      checkEndOfChain(*consumerInfo);
+    }
+
+    // Drain without holding the lock: this can take as long as the backlog.
+    EventProcessor &processor = consumerInfo->getEventProcessor();
+    const int64_t drainTo = ringBuffer_->getCursor();
+    while (hasStarted() && !consumerInfo->hasExited() &&
+           processor.getSequence().get() < drainTo) {
+      std::this_thread::yield();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(consumersMutex_);
+      if (consumerRepository_.getEventProcessorInfoFor(handler) != consumerInfo) {
+        return false; // removed concurrently
+      }
+      // A handler may have been attached behind this one during the drain.
+      checkEndOfChain(*consumerInfo);
+      // Unregister now so nothing can be attached behind it from here on.
+      processor.halt();
+      consumerRepository_.remove(handler);
+    }
+
+    // Join outside the lock: onShutdown may call halt() or a locked getter.
+    consumerInfo->join();
+
+    // Erasing from ownedProcessors_ frees the processor, so drop everything
+    // keyed by its sequence first.
+    Sequence *sequence = &processor.getSequence();
+    std::lock_guard<std::mutex> metricsLock(metricsMutex_);
+    maxSampledLags_.erase(sequence);
+    std::lock_guard<std::mutex> lock(consumersMutex_);
+    ringBuffer_->removeGatingSequence(*sequence);
+    std::erase(ownedBarriers_, consumerInfo->getBarrier());
+    std::erase_if(ownedProcessors_,
+                  [&processor](const std::shared_ptr<EventProcessor> &owned) {
+                    return owned.get() == &processor;
+                  });
+    return true;
+  }
 
   void shutdown() {
     try {
@@ -216,20 +399,71 @@ public:
   T &get(int64_t sequence) { return ringBuffer_->get(sequence); }
 
   BarrierPtr getBarrierFor(EventHandlerIdentity &handlerIdentity) {
+    std::lock_guard<std::mutex> lock(consumersMutex_);
     return consumerRepository_.getBarrierFor(handlerIdentity);
   }
   int64_t getSequenceValueFor(EventHandlerIdentity &handlerIdentity) {
+    std::lock_guard<std::mutex> lock(consumersMutex_);
     return consumerRepository_.getSequenceFor(handlerIdentity).get();
   }
 
   bool hasBacklog() {
+    std::lock_guard<std::mutex> lock(consumersMutex_);
     return consumerRepository_.hasBacklog(ringBuffer_->getCursor(), false);
   }
 
   int getProcessorCount() const {
+    std::lock_guard<std::mutex> lock(consumersMutex_);
     return consumerRepository_.getProcessorCount();
   }
 
+  // Lock-free read of cursor, consumer sequences and producer wrap-wait
+  // counters. Max sampled lag and publish rate are derived from successive
+  // snapshots, so poll periodically from one monitoring thread (concurrent callers are
+  // serialized; producers and consumers are never blocked).
+  DisruptorMetrics getMetrics() {
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+
+    DisruptorMetrics metrics;
+    metrics.timestampNanos = util::Util::nanoTime();
+    metrics.cursor = ringBuffer_->getCursor();
+    metrics.bufferSize = ringBuffer_->getBufferSize();
+    metrics.remainingCapacity =
+        metrics.bufferSize -
+        (metrics.cursor - ringBuffer_->getMinimumGatingSequence());
+
+    const auto &sequencer = ringBuffer_->getSequencer();
+    metrics.wrapWaitCount = sequencer.getWrapWaitCount();
+    metrics.wrapWaitNanos = sequencer.getWrapWaitNanos();
+
+    if (lastMetricsNanos_ != 0 &&
+        metrics.timestampNanos > lastMetricsNanos_) {
+      metrics.publishRatePerSecond =
+          static_cast<double>(metrics.cursor - lastMetricsCursor_) * 1e9 /
+          static_cast<double>(metrics.timestampNanos - lastMetricsNanos_);
+    }
+    lastMetricsNanos_ = metrics.timestampNanos;
+    lastMetricsCursor_ = metrics.cursor;
+
+    std::lock_guard<std::mutex> consumersLock(consumersMutex_);
+    consumerRepository_.forEachSequence(
+        [&](const Sequence &sequence, bool endOfChain, bool running) {
+          ConsumerMetrics consumer;
+          consumer.index = static_cast<int>(metrics.consumers.size());
+          consumer.sequence = sequence.get();
+          consumer.lag = (std::max)(int64_t{0},
+                                    metrics.cursor - consumer.sequence);
+          consumer.endOfChain = endOfChain;
+          consumer.running = running;
+          auto &maxLag = maxSampledLags_[&sequence];
+          maxLag = (std::max)(maxLag, consumer.lag);
+          consumer.maxSampledLag = maxLag;
+          metrics.consumers.push_back(consumer);
+        });
+
+    return metrics;
+  }
+
   // Core builder used by EventHandlerGroup
   template <typename... Handlers>
   EventHandlerGroup<T, Producer, WaitStrategyT>
@@ -258,6 +492,88 @@ public:
         static_cast<int>(processorSequences.size()));
   }
 
+  // Java 3.x: createWorkerPool(Sequence[] barrierSequences, WorkHandler<? super T>[] workHandlers)
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  createWorkerPool(Sequence *const *barrierSequences, int barrierCount,
+                   ::disruptor::WorkHandler<T> *const *workHandlers, int count,
+                   int maxClaimBatch) {
+    checkNotStarted();
+
+    auto sequenceBarrier =
+        ringBuffer_->newBarrier(barrierSequences, barrierCount);
+    ownedBarriers_.push_back(sequenceBarrier);
+    auto workerPool = std::make_shared<WorkerPoolT>(
+        *ringBuffer_, *sequenceBarrier, getExceptionHandler(), workHandlers,
+        count, maxClaimBatch);
+    ownedWorkerPools_.push_back(workerPool);
+
+    consumerRepository_.add(*workerPool, sequenceBarrier);
+
+    const std::vector<Sequence *> workerSequences =
+        workerPool->getWorkerSequences();
+
+    // Java: updateGatingSequencesForNextInChain(barrierSequences, workerSequences)
+    ringBuffer_->addGatingSequences(workerSequences.data(),
+                                    static_cast<int>(workerSequences.size()));
+    updateGatingSequencesForNextInChain(barrierSequences, barrierCount,
+                                        workerSequences);
+    consumerRepository_.unMarkEventProcessorsAsEndOfChain(barrierSequences,
+                                                          barrierCount);
+
+    return EventHandlerGroup<T, Producer, WaitStrategyT>(
+        *this, consumerRepository_, workerSequences.data(),
+        static_cast<int>(workerSequences.size()));
+  }
+
+  template <typename KeyFn>
+  EventHandlerGroup<T, Producer, WaitStrategyT> createPartitionedEventProcessors(
+      Sequence *const *barrierSequences, int barrierCount, KeyFn keyFn,
+      ::disruptor::EventHandlerBase<T> *const *handlers, int count) {
+    checkNotStarted();
+    if (count < 1) {
+      throw std::invalid_argument("At least one partition handler is required");
+    }
+
+    consumerRepository_.unMarkEventProcessorsAsEndOfChain(barrierSequences,
+                                                          barrierCount);
+
+    using PartitionT = PartitionEventProcessor<T, BarrierT>;
+    using DispatcherT = PartitionDispatcher<T, BarrierT, PartitionT, KeyFn>;
+
+    auto dispatchBarrier =
+        ringBuffer_->newBarrier(barrierSequences, barrierCount);
+    ownedBarriers_.push_back(dispatchBarrier);
+    auto dispatcher = std::make_shared<DispatcherT>(
+        *ringBuffer_, *dispatchBarrier, std::move(keyFn));
+    dispatcher->setExceptionHandler(getExceptionHandler());
+    Sequence *dispatcherSequence[] = {&dispatcher->getSequence()};
+    consumerRepository_.add(*dispatcher);
+    ownedProcessors_.push_back(dispatcher);
+
+    std::vector<Sequence *> processorSequences;
+    for (int i = 0; i < count; ++i) {
+      auto barrier = ringBuffer_->newBarrier(dispatcherSequence, 1);
+      ownedBarriers_.push_back(barrier);
+      auto partition = std::make_shared<PartitionT>(
+          *ringBuffer_, *barrier, *handlers[i], ringBuffer_->getBufferSize());
+      partition->setExceptionHandler(getExceptionHandler());
+      dispatcher->addPartition(*partition);
+      consumerRepository_.add(*partition, *handlers[i], barrier);
+      ownedProcessors_.push_back(partition);
+      processorSequences.push_back(&partition->getSequence());
+    }
+
+    // The partitions trail the dispatcher, so they alone gate the ring.
+    ringBuffer_->addGatingSequences(
+        processorSequences.data(), static_cast<int>(processorSequences.size()));
+    updateGatingSequencesForNextInChain(barrierSequences, barrierCount,
+                                        processorSequences);
+
+    return EventHandlerGroup<T, Producer, WaitStrategyT>(
+        *this, consumerRepository_, processorSequences.data(),
+        static_cast<int>(processorSequences.size()));
+  }
+
 private:
   friend class EventHandlerGroup<T, Producer, WaitStrategyT>;
 
@@ -276,6 +592,8 @@ private:
   // disruptor. Must be declared before consumerRepository_ so processors are
   // destroyed after EventProcessorInfo (which holds raw pointers to them).
   std::vector<std::shared_ptr<EventProcessor>> ownedProcessors_;
+  using WorkerPoolT = WorkerPool<T, RingBufferT, BarrierT>;
+  std::vector<std::shared_ptr<WorkerPoolT>> ownedWorkerPools_;
   ConsumerRepository<BarrierPtr> consumerRepository_;
   std::atomic<bool> started_;
   std::unique_ptr<ExceptionHandler<T>> exceptionHandler_;
@@ -285,6 +603,18 @@ private:
   // that reference them.
   std::vector<BarrierPtr> ownedBarriers_;
 
+  // Guards consumerRepository_ (and the owned processors/barriers) once
+  // handlers can be attached and detached while running. Lock order:
+  // metricsMutex_ before consumersMutex_.
+  mutable std::mutex consumersMutex_;
+
+  // State carried between getMetrics() snapshots.
+  std::mutex metricsMutex_;
+  int64_t lastMetricsNanos_{0};
+  int64_t lastMetricsCursor_{0};
+  // Keyed by consumer sequence, so removing a handler keeps the others' history.
+  std::unordered_map<const Sequence *, int64_t> maxSampledLags_;
+
   // Helper to get the current exception handler (either owned or external)
   ExceptionHandler<T> &getExceptionHandler() {
     if (exceptionHandlerPtr_ != nullptr) {
@@ -308,6 +638,23 @@ private:
     }
   }
 
+  // Partition processors are referenced by their dispatcher, so only plain
+  // BatchEventProcessors can be detached on their own.
+  static void checkRemovable(EventProcessorInfo<BarrierPtr> &consumerInfo) {
+    if (dynamic_cast<BatchEventProcessor<T, BarrierT> *>(
+            &consumerInfo.getEventProcessor()) == nullptr) {
+      throw std::invalid_argument(
+          "Only handlers run by a BatchEventProcessor can be removed.");
+    }
+  }
+
+  static void checkEndOfChain(EventProcessorInfo<BarrierPtr> &consumerInfo) {
+    if (!consumerInfo.isEndOfChain()) {
+      throw std::invalid_argument(
+          "Cannot remove an event handler that other handlers depend on.");
+    }
+  }
+
   // Helper: add processors for handlers/factories; this is a reduced surface
   // sufficient for current port.
   void createEventProcessorsImpl(Sequence *const *barrierSequences,
@@ -0,0 +1,109 @@
+#pragma once
+// Occupancy / backpressure snapshot for dsl::Disruptor.
+//
+// Produced by Disruptor::getMetrics(), which only reads existing Sequences and
+// relaxed counters, so it can be polled from a monitoring thread while
+// producers and consumers are running. Rendered with toPrometheus()/toJson().
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace disruptor::dsl {
+
+struct ConsumerMetrics {
+  int index = 0;         // registration order in the Disruptor
+  int64_t sequence = 0;  // last processed sequence
+  int64_t lag = 0;       // cursor - sequence
+  // Largest lag seen by a getMetrics() snapshot. Lag is sampled only when a
+  // snapshot is taken, so peaks between polls are not captured.
+  int64_t maxSampledLag = 0;
+  bool endOfChain = false;
+  bool running = false;
+};
+
+struct DisruptorMetrics {
+  int64_t timestampNanos = 0;
+  int64_t cursor = 0;
+  int bufferSize = 0;
+  int64_t remainingCapacity = 0;
+  // Producer claims that had to wait for consumers (ring full), and the total
+  // time spent waiting.
+  uint64_t wrapWaitCount = 0;
+  int64_t wrapWaitNanos = 0;
+  // Events published per second since the previous snapshot (0 on the first).
+  double publishRatePerSecond = 0.0;
+  std::vector<ConsumerMetrics> consumers;
+};
+
+// Prometheus text exposition format. `prefix` is prepended to every metric
+// name (e.g. "orders" -> orders_cursor).
+inline std::string toPrometheus(const DisruptorMetrics &metrics,
+                                std::string_view prefix = "disruptor") {
+  std::ostringstream out;
+  const std::string p(prefix);
+  auto gauge = [&](const char *name, const char *help, auto value) {
+    out << "# HELP " << p << '_' << name << ' ' << help << '\n';
+    out << "# TYPE " << p << '_' << name << " gauge\n";
+    out << p << '_' << name << ' ' << value << '\n';
+  };
+  auto counter = [&](const char *name, const char *help, auto value) {
+    out << "# HELP " << p << '_' << name << ' ' << help << '\n';
+    out << "# TYPE " << p << '_' << name << " counter\n";
+    out << p << '_' << name << ' ' << value << '\n';
+  };
+  auto perConsumer = [&](const char *name, const char *help, auto field) {
+    out << "# HELP " << p << '_' << name << ' ' << help << '\n';
+    out << "# TYPE " << p << '_' << name << " gauge\n";
+    for (const auto &c : metrics.consumers) {
+      out << p << '_' << name << "{consumer=\"" << c.index << "\"} "
+          << field(c) << '\n';
+    }
+  };
+
+  gauge("cursor", "Highest published sequence.", metrics.cursor);
+  gauge("buffer_size", "Ring buffer size in slots.", metrics.bufferSize);
+  gauge("remaining_capacity", "Free slots before producers must wait.",
+        metrics.remainingCapacity);
+  counter("wrap_wait_total", "Producer claims that waited for consumers.",
+          metrics.wrapWaitCount);
+  counter("wrap_wait_seconds_total",
+          "Time producers spent waiting for consumers.",
+          static_cast<double>(metrics.wrapWaitNanos) / 1e9);
+  gauge("publish_rate", "Events published per second since the last snapshot.",
+        metrics.publishRatePerSecond);
+  perConsumer("consumer_sequence", "Last sequence processed by the consumer.",
+              [](const ConsumerMetrics &c) { return c.sequence; });
+  perConsumer("consumer_lag", "Cursor minus consumer sequence.",
+              [](const ConsumerMetrics &c) { return c.lag; });
+  perConsumer("consumer_max_sampled_lag",
+              "Largest consumer lag seen by a metrics snapshot.",
+              [](const ConsumerMetrics &c) { return c.maxSampledLag; });
+  return out.str();
+}
+
+inline std::string toJson(const DisruptorMetrics &metrics) {
+  std::ostringstream out;
+  out << "{\"timestampNanos\":" << metrics.timestampNanos
+      << ",\"cursor\":" << metrics.cursor
+      << ",\"bufferSize\":" << metrics.bufferSize
+      << ",\"remainingCapacity\":" << metrics.remainingCapacity
+      << ",\"wrapWaitCount\":" << metrics.wrapWaitCount
+      << ",\"wrapWaitNanos\":" << metrics.wrapWaitNanos
+      << ",\"publishRatePerSecond\":" << metrics.publishRatePerSecond
+      << ",\"consumers\":[";
+  for (size_t i = 0; i < metrics.consumers.size(); ++i) {
+    const auto &c = metrics.consumers[i];
+    out << (i == 0 ? "" : ",") << "{\"index\":" << c.index
+        << ",\"sequence\":" << c.sequence << ",\"lag\":" << c.lag
+        << ",\"maxSampledLag\":" << c.maxSampledLag
+        << ",\"endOfChain\":" << (c.endOfChain ? "true" : "false")
+        << ",\"running\":" << (c.running ? "true" : "false") << '}';
+  }
+  out << "]}";
+  return out.str();
+}
+
+} // namespace disruptor::dsl
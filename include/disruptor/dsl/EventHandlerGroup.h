@@ -10,12 +10,15 @@
 #include "../EventProcessor.h"
 #include "../RewindableEventHandler.h"
 #include "../Sequence.h"
+#include "../WorkHandler.h"
 #include "ConsumerRepository.h"
 #include "EventProcessorFactory.h"
 #include "ProducerType.h"
 
 
 #include <algorithm>
+#include <concepts>
+#include <utility>
 #include <vector>
 
 namespace disruptor::dsl {
@@ -72,6 +75,53 @@ public:
         sequences_.data(), static_cast<int>(sequences_.size()), handlers...);
   }
 
+  // Java 3.x: thenHandleEventsWithWorkerPool / handleEventsWithWorkerPool
+  template <typename... WorkHandlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  thenHandleEventsWithWorkerPool(WorkHandlers &...workHandlers) {
+    return handleEventsWithWorkerPool(workHandlers...);
+  }
+
+  template <typename... WorkHandlers>
+    requires(sizeof...(WorkHandlers) > 0 &&
+             (std::derived_from<WorkHandlers, ::disruptor::WorkHandler<T>> &&
+              ...))
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithWorkerPool(WorkHandlers &...workHandlers) {
+    ::disruptor::WorkHandler<T> *list[] = {&workHandlers...};
+    return handleEventsWithWorkerPool(
+        list, static_cast<int>(sizeof...(WorkHandlers)));
+  }
+
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithWorkerPool(::disruptor::WorkHandler<T> *const *workHandlers,
+                             int count, int maxClaimBatch = 1) {
+    return disruptor_->createWorkerPool(sequences_.data(),
+                                        static_cast<int>(sequences_.size()),
+                                        workHandlers, count, maxClaimBatch);
+  }
+
+  template <typename KeyFn, typename... Handlers>
+    requires(sizeof...(Handlers) > 0 &&
+             (std::derived_from<Handlers, ::disruptor::EventHandlerBase<T>> &&
+              ...))
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithPartitioned(KeyFn keyFn, Handlers &...handlers) {
+    ::disruptor::EventHandlerBase<T> *list[] = {&handlers...};
+    return handleEventsWithPartitioned(std::move(keyFn), list,
+                                       static_cast<int>(sizeof...(Handlers)));
+  }
+
+  template <typename KeyFn>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithPartitioned(KeyFn keyFn,
+                              ::disruptor::EventHandlerBase<T> *const *handlers,
+                              int count) {
+    return disruptor_->createPartitionedEventProcessors(
+        sequences_.data(), static_cast<int>(sequences_.size()),
+        std::move(keyFn), handlers, count);
+  }
+
   template <typename... Factories>
   EventHandlerGroup<T, Producer, WaitStrategyT>
   thenFactories(Factories &...factories) {
@@ -8,7 +8,9 @@
 #include "ConsumerInfo.h"
 #include "ThreadFactory.h"
 
+#include <atomic>
 #include <latch>
+#include <mutex>
 #include <thread>
 
 namespace disruptor::dsl {
@@ -47,9 +49,10 @@ public:
       // Critical: count_down() must be called even if thread creation fails
       // to prevent deadlock in Startup()
       try {
-        thread_ = threadFactory.newThread([ep, startupLatch] {
+        thread_ = threadFactory.newThread([this, ep, startupLatch] {
           startupLatch->count_down(); // Signal that this thread has started
           ep->run();                  // Execute the processor
+          exited_.store(true, std::memory_order_release);
         });
       } catch (...) {
         // If thread creation fails, still signal latch to prevent deadlock
@@ -57,27 +60,40 @@ public:
         throw; // Re-throw to propagate the error
       }
     } else {
-      thread_ = threadFactory.newThread([ep] { ep->run(); });
+      thread_ = threadFactory.newThread([this, ep] {
+        ep->run();
+        exited_.store(true, std::memory_order_release);
+      });
     }
   }
 
   void halt() override { eventprocessor_->halt(); }
 
+  // C++ addition: Disruptor::join() and removeHandlerWhileRunning() may join
+  // the same info concurrently, so joins are serialised.
   void join() override {
+    std::lock_guard<std::mutex> lock(joinMutex_);
     if (thread_.joinable()) {
       thread_.join();
     }
   }
 
   void markAsUsedInBarrier() override { endOfChain_ = false; }
+  void markAsEndOfChain() override { endOfChain_ = true; }
 
   bool isRunning() override { return eventprocessor_->isRunning(); }
 
+  // C++ addition: true once the started thread has returned from run().
+  // Unlike isRunning(), this is false before the thread gets going.
+  bool hasExited() const { return exited_.load(std::memory_order_acquire); }
+
 private:
   EventProcessor *eventprocessor_;
   BarrierPtrT barrier_;
   bool endOfChain_;
   std::thread thread_{};
+  std::mutex joinMutex_;
+  std::atomic<bool> exited_{false};
 };
 
 } // namespace disruptor::dsl
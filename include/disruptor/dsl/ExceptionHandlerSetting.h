@@ -6,6 +6,7 @@
 #include "../EventHandlerIdentity.h"
 #include "../EventProcessor.h"
 #include "../ExceptionHandler.h"
+#include "../PartitionedEventProcessor.h"
 #include "ConsumerRepository.h"
 
 #include <stdexcept>
@@ -22,10 +23,15 @@ public:
   void with(ExceptionHandler<T>& exceptionHandler) {
     EventProcessor& eventProcessor = consumerRepository_->getEventProcessorFor(*handlerIdentity_);
     auto* batch = dynamic_cast<BatchEventProcessor<T, BarrierT>*>(&eventProcessor);
+    auto* partition = dynamic_cast<PartitionEventProcessor<T, BarrierT>*>(&eventProcessor);
     if (batch != nullptr) {
       batch->setExceptionHandler(exceptionHandler);
       auto barrier = consumerRepository_->getBarrierFor(*handlerIdentity_);
       if (barrier) barrier->alert();
+    } else if (partition != nullptr) {
+      partition->setExceptionHandler(exceptionHandler);
+      auto barrier = consumerRepository_->getBarrierFor(*handlerIdentity_);
+      if (barrier) barrier->alert();
     } else {
       throw std::runtime_error("EventProcessor is not a BatchEventProcessor and does not support exception handlers");
     }
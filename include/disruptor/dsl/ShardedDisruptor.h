@@ -0,0 +1,311 @@
+#pragma once
+// Multi-producer front-end for Disruptor: each producer thread claims its own
+// single-producer shard, and one merge thread copies shard batches into an
+// ordinary single-producer Disruptor that runs the handler graph. Each
+// shard's events keep their order; MergeOrder decides the order across shards.
+
+#include "../EpochWaitStrategy.h"
+#include "../EventFactory.h"
+#include "../RingBuffer.h"
+#include "../Sequence.h"
+#include "../util/ThreadHints.h"
+
+#include "Disruptor.h"
+#include "ProducerType.h"
+#include "ThreadFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace disruptor::dsl {
+
+// Default MergeOrder for ShardedDisruptor: round-robin, no cross-shard order.
+struct UnorderedMerge final {};
+
+// Any other MergeOrder is a callable int64_t(const T&), e.g. a timestamp:
+// the events visible in each pass are merged by that key, ties going to the
+// lower shard. T must be copy-assignable.
+template <typename T, typename WaitStrategyT,
+          typename MergeOrder = UnorderedMerge>
+class ShardedDisruptor {
+public:
+  using ShardRingBufferT = SingleProducerRingBuffer<T, EpochWaitStrategy>;
+  using DisruptorT = Disruptor<T, ProducerType::SINGLE, WaitStrategyT>;
+
+  ShardedDisruptor(std::shared_ptr<EventFactory<T>> eventFactory,
+                   int shardCount, int shardBufferSize, int ringBufferSize,
+                   ThreadFactory &threadFactory, MergeOrder mergeOrder = {},
+                   int maxBatchPerShard = 64, int idleSpins = 100)
+      : disruptor_(eventFactory, ringBufferSize, threadFactory),
+        threadFactory_(threadFactory), mergeOrder_(std::move(mergeOrder)),
+        maxBatchPerShard_(maxBatchPerShard), idleSpins_(idleSpins) {
+    if (shardCount < 1) {
+      throw std::invalid_argument("shardCount must be greater than 0");
+    }
+    if (maxBatchPerShard < 1) {
+      throw std::invalid_argument("maxBatchPerShard must be greater than 0");
+    }
+    for (int i = 0; i < shardCount; ++i) {
+      auto shard = std::make_unique<Shard>();
+      shard->ringBuffer = ShardRingBufferT::createSingleProducer(
+          eventFactory, shardBufferSize, shardWaitStrategy_);
+      shard->ringBuffer->addGatingSequences(shard->consumed);
+      shards_.push_back(std::move(shard));
+    }
+    if constexpr (!kUnordered) {
+      heads_.resize(shards_.size());
+      ends_.resize(shards_.size());
+      capped_.resize(shards_.size());
+    }
+  }
+
+  ~ShardedDisruptor() {
+    // The merge thread publishes into disruptor_, so stop it first.
+    haltMerger();
+  }
+
+  ShardedDisruptor(const ShardedDisruptor &) = delete;
+  ShardedDisruptor &operator=(const ShardedDisruptor &) = delete;
+
+  // Consumers: the usual DSL, on the merged ring.
+  template <typename... Handlers> auto handleEventsWith(Handlers &...handlers) {
+    return disruptor_.handleEventsWith(handlers...);
+  }
+  DisruptorT &getDisruptor() { return disruptor_; }
+
+  // Producers: each thread publishes to one shard only (shards are
+  // single-producer). claimShard() hands out the next unused shard.
+  ShardRingBufferT &claimShard() {
+    const int index = nextShard_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= getShardCount()) {
+      throw std::runtime_error("All shards have already been claimed");
+    }
+    return getShard(index);
+  }
+  ShardRingBufferT &getShard(int index) { return *shards_.at(index)->ringBuffer; }
+  int getShardCount() const { return static_cast<int>(shards_.size()); }
+
+  void start() {
+    bool expected = false;
+    if (!merging_.compare_exchange_strong(expected, true,
+                                          std::memory_order_acq_rel)) {
+      throw std::runtime_error("ShardedDisruptor.start() must only be called once.");
+    }
+    disruptor_.start();
+    mergeThread_ = threadFactory_.newThread([this] { merge(); });
+  }
+
+  // Stops merging and halts the consumers; events still in the shards are
+  // not delivered.
+  void halt() {
+    haltMerger();
+    disruptor_.halt();
+  }
+
+  void join() { disruptor_.join(); }
+
+  // Waits until every shard has been merged and the consumers have caught
+  // up, then halts. Producers must have stopped publishing.
+  void shutdown() {
+    while (shardsHaveBacklog()) {
+      util::ThreadHints::onSpinWait();
+    }
+    haltMerger();
+    disruptor_.shutdown();
+  }
+
+private:
+  static constexpr bool kUnordered = std::is_same_v<MergeOrder, UnorderedMerge>;
+
+  struct Shard {
+    std::shared_ptr<ShardRingBufferT> ringBuffer;
+    // The merge thread's progress; gates the shard's producer.
+    Sequence consumed;
+  };
+
+  EpochWaitStrategy shardWaitStrategy_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  DisruptorT disruptor_;
+  ThreadFactory &threadFactory_;
+  MergeOrder mergeOrder_;
+  int maxBatchPerShard_;
+  int idleSpins_;
+  std::atomic<int> nextShard_{0};
+  std::atomic<bool> merging_{false};
+  std::atomic<bool> haltRequested_{false};
+  std::thread mergeThread_;
+
+  // Per-pass scratch for the ordered merge (merge thread only).
+  std::vector<int64_t> heads_;
+  std::vector<int64_t> ends_;
+  // Whether a shard had more visible events than its window.
+  std::vector<bool> capped_;
+  // Shard of each event in the pass's output order.
+  std::vector<size_t> picks_;
+
+  void haltMerger() {
+    haltRequested_.store(true, std::memory_order_seq_cst);
+    shardWaitStrategy_.wakeAll();
+    if (mergeThread_.joinable()) {
+      mergeThread_.join();
+    }
+  }
+
+  bool shardsHaveBacklog() const {
+    for (const auto &shard : shards_) {
+      if (shard->consumed.get() < shard->ringBuffer->getCursor()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void merge() {
+    int idlePasses = 0;
+    while (!haltRequested_.load(std::memory_order_acquire)) {
+      if (mergePass()) {
+        idlePasses = 0;
+        continue;
+      }
+      if (++idlePasses < idleSpins_) {
+        util::ThreadHints::onSpinWait();
+        continue;
+      }
+
+      const uint32_t epoch = shardWaitStrategy_.prepareToPark();
+      if (haltRequested_.load(std::memory_order_acquire)) {
+        break;
+      }
+      if (mergePass()) {
+        idlePasses = 0;
+        continue;
+      }
+      shardWaitStrategy_.park(epoch);
+    }
+  }
+
+  // Claims n slots on the merged ring. Gives up once a halt is requested, as
+  // the ring may stay full if its consumers have stopped.
+  std::optional<int64_t> claimMerged(int n) {
+    auto &target = disruptor_.getRingBuffer();
+    while (true) {
+      if (const std::optional<int64_t> hi = target.tryClaim(n)) {
+        return hi;
+      }
+      if (haltRequested_.load(std::memory_order_acquire)) {
+        return std::nullopt;
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  // true if anything was merged
+  bool mergePass() {
+    if constexpr (kUnordered) {
+      return mergeRoundRobin();
+    } else {
+      return mergeOrdered();
+    }
+  }
+
+  bool mergeRoundRobin() {
+    auto &target = disruptor_.getRingBuffer();
+    const int64_t maxBatch =
+        (std::min)(maxBatchPerShard_, target.getBufferSize());
+    bool merged = false;
+    for (auto &shard : shards_) {
+      const int64_t next = shard->consumed.get() + 1;
+      const int64_t available = shard->ringBuffer->getCursor();
+      if (available < next) {
+        continue;
+      }
+      const int n = static_cast<int>((std::min)(available - next + 1, maxBatch));
+      const std::optional<int64_t> claimed = claimMerged(n);
+      if (!claimed) {
+        return merged;
+      }
+      const int64_t hi = *claimed;
+      const int64_t lo = hi - (n - 1);
+      for (int i = 0; i < n; ++i) {
+        target.get(lo + i) = shard->ringBuffer->get(next + i);
+      }
+      target.publish(lo, hi);
+      shard->consumed.set(next + n - 1);
+      merged = true;
+    }
+    return merged;
+  }
+
+  bool mergeOrdered() {
+    auto &target = disruptor_.getRingBuffer();
+    bool visible = false;
+    for (size_t s = 0; s < shards_.size(); ++s) {
+      const int64_t cursor = shards_[s]->ringBuffer->getCursor();
+      heads_[s] = shards_[s]->consumed.get() + 1;
+      ends_[s] = (std::min)(cursor, heads_[s] + maxBatchPerShard_ - 1);
+      capped_[s] = cursor > ends_[s];
+      visible = visible || heads_[s] <= ends_[s];
+    }
+    if (!visible) {
+      return false;
+    }
+
+    // Choose the order before claiming. Once a capped shard's window is used
+    // up, its next visible event may sort before anything the other shards
+    // still hold, so the pass stops there.
+    const size_t limit = static_cast<size_t>(target.getBufferSize());
+    picks_.clear();
+    while (picks_.size() < limit) {
+      size_t best = shards_.size();
+      int64_t bestKey = 0;
+      for (size_t s = 0; s < shards_.size(); ++s) {
+        if (heads_[s] > ends_[s]) {
+          continue;
+        }
+        const int64_t key = mergeOrder_(
+            static_cast<const T &>(shards_[s]->ringBuffer->get(heads_[s])));
+        if (best == shards_.size() || key < bestKey) {
+          best = s;
+          bestKey = key;
+        }
+      }
+      if (best == shards_.size()) {
+        break;
+      }
+      picks_.push_back(best);
+      if (++heads_[best] > ends_[best] && capped_[best]) {
+        break;
+      }
+    }
+
+    const int n = static_cast<int>(picks_.size());
+    const std::optional<int64_t> claimed = claimMerged(n);
+    if (!claimed) {
+      return false;
+    }
+    const int64_t hi = *claimed;
+    const int64_t lo = hi - (n - 1);
+    for (size_t s = 0; s < shards_.size(); ++s) {
+      heads_[s] = shards_[s]->consumed.get() + 1;
+    }
+    for (int i = 0; i < n; ++i) {
+      const size_t s = picks_[static_cast<size_t>(i)];
+      target.get(lo + i) = shards_[s]->ringBuffer->get(heads_[s]++);
+    }
+    target.publish(lo, hi);
+    for (size_t s = 0; s < shards_.size(); ++s) {
+      shards_[s]->consumed.set(heads_[s] - 1);
+    }
+    return true;
+  }
+};
+
+} // namespace disruptor::dsl
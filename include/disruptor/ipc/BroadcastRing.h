@@ -0,0 +1,572 @@
+#pragma once
+// One-writer, many-reader broadcast ring in POSIX shared memory. E must be
+// trivially copyable, and exactly one thread in one process may publish.
+// SlowSubscriberPolicy decides whether a subscriber a full ring behind blocks
+// the publisher or is dropped.
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "BroadcastRing requires POSIX shared memory"
+#endif
+
+#include "../util/ThreadHints.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace disruptor::ipc {
+
+enum class SlowSubscriberPolicy : uint32_t {
+  // The publisher waits; a dead reader gates until evictSubscriber().
+  BLOCK_PUBLISHER = 0,
+  // The publisher drops it; its next poll() returns DROPPED.
+  DROP_SUBSCRIBER = 1,
+};
+
+namespace detail {
+
+inline constexpr uint64_t kBroadcastMagic = 0x4e414e4f42524331ULL; // "NANOBRC1"
+inline constexpr uint32_t kBroadcastVersion = 2;
+inline constexpr size_t kCacheLine = 64;
+
+inline constexpr uint32_t kSlotFree = 0;
+inline constexpr uint32_t kSlotActive = 1;
+inline constexpr uint32_t kSlotDropped = 2;
+
+struct alignas(kCacheLine) SubscriberSlot {
+  std::atomic<int64_t> sequence;
+  std::atomic<uint32_t> state;
+};
+
+struct SegmentHeader {
+  // Set once by create(); magic is stored last.
+  alignas(kCacheLine) std::atomic<uint64_t> magic;
+  uint32_t version;
+  uint32_t eventSize;
+  int32_t bufferSize;
+  int32_t maxSubscribers;
+  SlowSubscriberPolicy policy;
+
+  // Publisher-written.
+  alignas(kCacheLine) std::atomic<int64_t> cursor;
+  alignas(kCacheLine) std::atomic<int64_t> claimed;
+
+  // The summary line, read by the publisher. minimumSequence is meaningful
+  // only while activeCount > 0 and only ever rises; activeCount changes only
+  // under lock.
+  alignas(kCacheLine) std::atomic<int64_t> minimumSequence;
+  std::atomic<int32_t> activeCount;
+
+  // Membership changes only. A process that dies holding it leaves the
+  // segment unusable.
+  alignas(kCacheLine) std::atomic<uint32_t> lock;
+  std::atomic<int64_t> droppedCount;
+};
+
+static_assert(std::atomic<int64_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<int32_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "Shared-memory atomics must be lock-free (and so address-free)");
+
+inline size_t alignUp(size_t value, size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+[[noreturn]] inline void throwErrno(const char* what) { throw std::system_error(errno, std::generic_category(), what); }
+
+} // namespace detail
+
+template <typename E>
+class BroadcastSubscriber;
+
+template <typename E>
+class BroadcastRing final {
+  static_assert(std::is_trivially_copyable_v<E>, "BroadcastRing events must be trivially copyable");
+
+public:
+  using EventType = E;
+
+  // Creates and initialises the segment; fails if the name already exists.
+  static BroadcastRing create(const std::string& name, int bufferSize, int maxSubscribers,
+                              SlowSubscriberPolicy policy = SlowSubscriberPolicy::BLOCK_PUBLISHER) {
+    if (bufferSize < 1) {
+      throw std::invalid_argument("bufferSize must not be less than 1");
+    }
+    if ((bufferSize & (bufferSize - 1)) != 0) {
+      throw std::invalid_argument("bufferSize must be a power of 2");
+    }
+    if (maxSubscribers < 1) {
+      throw std::invalid_argument("maxSubscribers must be greater than 0");
+    }
+
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+      detail::throwErrno("shm_open");
+    }
+    const size_t size = segmentSize(bufferSize, maxSubscribers);
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+      const int error = errno;
+      ::close(fd);
+      ::shm_unlink(name.c_str());
+      throw std::system_error(error, std::generic_category(), "ftruncate");
+    }
+    void* base = mapOrUnlink(fd, size, name);
+
+    auto* header = new (base) detail::SegmentHeader{};
+    header->version = detail::kBroadcastVersion;
+    header->eventSize = static_cast<uint32_t>(sizeof(E));
+    header->bufferSize = bufferSize;
+    header->maxSubscribers = maxSubscribers;
+    header->policy = policy;
+    header->cursor.store(-1, std::memory_order_relaxed);
+    header->claimed.store(-1, std::memory_order_relaxed);
+    header->minimumSequence.store(-1, std::memory_order_relaxed);
+    header->activeCount.store(0, std::memory_order_relaxed);
+    header->lock.store(0, std::memory_order_relaxed);
+    header->droppedCount.store(0, std::memory_order_relaxed);
+    auto* slots = reinterpret_cast<detail::SubscriberSlot*>(static_cast<std::byte*>(base) + slotsOffset());
+    for (int i = 0; i < maxSubscribers; ++i) {
+      auto* slot = new (&slots[i]) detail::SubscriberSlot{};
+      slot->sequence.store(-1, std::memory_order_relaxed);
+      slot->state.store(detail::kSlotFree, std::memory_order_relaxed);
+    }
+    header->magic.store(detail::kBroadcastMagic, std::memory_order_release);
+
+    return BroadcastRing(base, size, name);
+  }
+
+  // Maps an existing segment created by create() with the same E.
+  static BroadcastRing open(const std::string& name) {
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+      detail::throwErrno("shm_open");
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+      const int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), "fstat");
+    }
+    const size_t size = static_cast<size_t>(st.st_size);
+    if (size < sizeof(detail::SegmentHeader)) {
+      ::close(fd);
+      throw std::runtime_error("Shared memory segment is not a BroadcastRing");
+    }
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int mapError = errno;
+    ::close(fd);
+    if (base == MAP_FAILED) {
+      throw std::system_error(mapError, std::generic_category(), "mmap");
+    }
+
+    const auto* header = static_cast<const detail::SegmentHeader*>(base);
+    const char* error = nullptr;
+    if (header->magic.load(std::memory_order_acquire) != detail::kBroadcastMagic ||
+        header->version != detail::kBroadcastVersion) {
+      error = "Shared memory segment is not a BroadcastRing";
+    } else if (header->eventSize != sizeof(E)) {
+      error = "BroadcastRing event size does not match";
+    } else if (segmentSize(header->bufferSize, header->maxSubscribers) > size) {
+      error = "BroadcastRing segment is truncated";
+    }
+    if (error != nullptr) {
+      ::munmap(base, size);
+      throw std::runtime_error(error);
+    }
+    return BroadcastRing(base, size, std::string());
+  }
+
+  BroadcastRing(BroadcastRing&& other) noexcept
+      : base_(std::exchange(other.base_, nullptr)),
+        size_(other.size_),
+        ownedName_(std::move(other.ownedName_)),
+        header_(other.header_),
+        slots_(other.slots_),
+        entries_(other.entries_),
+        indexMask_(other.indexMask_),
+        nextValue_(other.nextValue_),
+        cachedGatingSequence_(other.cachedGatingSequence_) {
+    other.ownedName_.clear();
+  }
+
+  BroadcastRing(const BroadcastRing&) = delete;
+  BroadcastRing& operator=(const BroadcastRing&) = delete;
+  BroadcastRing& operator=(BroadcastRing&&) = delete;
+
+  ~BroadcastRing() {
+    if (base_ != nullptr) {
+      ::munmap(base_, size_);
+    }
+    if (!ownedName_.empty()) {
+      ::shm_unlink(ownedName_.c_str());
+    }
+  }
+
+  // --- Publisher (one thread, one process) ---
+
+  int64_t next() { return next(1); }
+
+  int64_t next(int n) {
+    if (n < 1 || n > getBufferSize()) {
+      throw std::invalid_argument("n must be > 0 and < bufferSize");
+    }
+    const int64_t nextSequence = nextValue_ + n;
+    const int64_t wrapPoint = nextSequence - getBufferSize();
+    if (wrapPoint > cachedGatingSequence_) {
+      cachedGatingSequence_ = awaitCapacity(wrapPoint);
+    }
+    nextValue_ = nextSequence;
+    header_->claimed.store(nextSequence, std::memory_order_release);
+    return nextSequence;
+  }
+
+  E& get(int64_t sequence) { return entries_[sequence & indexMask_]; }
+  const E& get(int64_t sequence) const { return entries_[sequence & indexMask_]; }
+
+  void publish(int64_t sequence) { header_->cursor.store(sequence, std::memory_order_release); }
+  void publish(int64_t /*lo*/, int64_t hi) { publish(hi); }
+
+  // --- Monitoring and administration (any process) ---
+
+  int64_t getCursor() const { return header_->cursor.load(std::memory_order_acquire); }
+  int getBufferSize() const { return header_->bufferSize; }
+  int getMaxSubscribers() const { return header_->maxSubscribers; }
+  SlowSubscriberPolicy getPolicy() const { return header_->policy; }
+  int getActiveSubscriberCount() const { return header_->activeCount.load(std::memory_order_acquire); }
+  int64_t getDroppedCount() const { return header_->droppedCount.load(std::memory_order_acquire); }
+
+  // Lowest sequence among active subscribers, or the cursor if there are none.
+  int64_t getMinimumSubscriberSequence() const {
+    return getActiveSubscriberCount() == 0 ? getCursor() : header_->minimumSequence.load(std::memory_order_acquire);
+  }
+
+  bool isSubscriberActive(int slot) const {
+    return slots_[checkSlot(slot)].state.load(std::memory_order_acquire) == detail::kSlotActive;
+  }
+
+  int64_t getSubscriberSequence(int slot) const {
+    return slots_[checkSlot(slot)].sequence.load(std::memory_order_acquire);
+  }
+
+  // Drops an active subscriber, e.g. one whose process has died while it
+  // was gating the publisher. Returns false if the slot was not active.
+  bool evictSubscriber(int slot) {
+    checkSlot(slot);
+    SpinLock lock(*header_);
+    if (slots_[slot].state.load(std::memory_order_relaxed) != detail::kSlotActive) {
+      return false;
+    }
+    dropLocked(slot);
+    recomputeMinimumLocked();
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+  }
+
+private:
+  friend class BroadcastSubscriber<E>;
+
+  class SpinLock {
+  public:
+    explicit SpinLock(detail::SegmentHeader& header) : lock_(&header.lock) {
+      uint32_t expected = 0;
+      while (!lock_->compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+        expected = 0;
+        util::ThreadHints::onSpinWait();
+      }
+    }
+    ~SpinLock() { lock_->store(0, std::memory_order_release); }
+    SpinLock(const SpinLock&) = delete;
+    SpinLock& operator=(const SpinLock&) = delete;
+
+  private:
+    std::atomic<uint32_t>* lock_;
+  };
+
+  BroadcastRing(void* base, size_t size, std::string ownedName)
+      : base_(base),
+        size_(size),
+        ownedName_(std::move(ownedName)),
+        header_(static_cast<detail::SegmentHeader*>(base)),
+        slots_(reinterpret_cast<detail::SubscriberSlot*>(static_cast<std::byte*>(base) + slotsOffset())),
+        entries_(reinterpret_cast<E*>(static_cast<std::byte*>(base) +
+                                      entriesOffset(header_->maxSubscribers))),
+        indexMask_(header_->bufferSize - 1),
+        nextValue_(header_->claimed.load(std::memory_order_acquire)),
+        cachedGatingSequence_((std::numeric_limits<int64_t>::min)()) {}
+
+  void* base_;
+  size_t size_;
+  std::string ownedName_;
+  detail::SegmentHeader* header_;
+  detail::SubscriberSlot* slots_;
+  E* entries_;
+  int64_t indexMask_;
+
+  // Publisher-local, like SingleProducerSequencer's fields.
+  int64_t nextValue_;
+  int64_t cachedGatingSequence_;
+
+  static size_t slotsOffset() { return detail::alignUp(sizeof(detail::SegmentHeader), detail::kCacheLine); }
+
+  static size_t entriesOffset(int maxSubscribers) {
+    return detail::alignUp(slotsOffset() + static_cast<size_t>(maxSubscribers) * sizeof(detail::SubscriberSlot),
+                           (std::max)(detail::kCacheLine, alignof(E)));
+  }
+
+  static size_t segmentSize(int bufferSize, int maxSubscribers) {
+    return entriesOffset(maxSubscribers) + static_cast<size_t>(bufferSize) * sizeof(E);
+  }
+
+  static void* mapOrUnlink(int fd, size_t size, const std::string& name) {
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int error = errno;
+    ::close(fd);
+    if (base == MAP_FAILED) {
+      ::shm_unlink(name.c_str());
+      throw std::system_error(error, std::generic_category(), "mmap");
+    }
+    return base;
+  }
+
+  int checkSlot(int slot) const {
+    if (slot < 0 || slot >= getMaxSubscribers()) {
+      throw std::out_of_range("subscriber slot out of range");
+    }
+    return slot;
+  }
+
+  // Reads only the summary line (and takes the lock to drop laggards).
+  int64_t awaitCapacity(int64_t wrapPoint) {
+    while (true) {
+      // Pairs with the fence in join(): either the joiner sees our last
+      // claim, or we see it counted here.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (header_->activeCount.load(std::memory_order_acquire) == 0) {
+        return wrapPoint;
+      }
+      const int64_t minimum = header_->minimumSequence.load(std::memory_order_acquire);
+      if (wrapPoint <= minimum) {
+        return minimum;
+      }
+      if (header_->policy == SlowSubscriberPolicy::DROP_SUBSCRIBER) {
+        dropLaggards(wrapPoint);
+        continue;
+      }
+      util::ThreadHints::onSpinWait();
+    }
+  }
+
+  void dropLaggards(int64_t wrapPoint) {
+    SpinLock lock(*header_);
+    for (int i = 0; i < getMaxSubscribers(); ++i) {
+      if (slots_[i].state.load(std::memory_order_relaxed) == detail::kSlotActive &&
+          slots_[i].sequence.load(std::memory_order_acquire) < wrapPoint) {
+        dropLocked(i);
+      }
+    }
+    recomputeMinimumLocked();
+    // A dropped reader that copies data written after this point is
+    // guaranteed to see its DROPPED state (see BroadcastSubscriber::poll).
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  void dropLocked(int slot) {
+    slots_[slot].state.store(detail::kSlotDropped, std::memory_order_relaxed);
+    header_->activeCount.fetch_sub(1, std::memory_order_relaxed);
+    header_->droppedCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void recomputeMinimumLocked() { raiseMinimum(scanMinimum((std::numeric_limits<int64_t>::min)())); }
+
+  // Lowest active subscriber sequence (max() if there are none). Stops early,
+  // returning a value <= bound, once some subscriber is still at or below
+  // bound. Joiners start at or after the latest claim, so a subscriber this
+  // misses never sits below the result.
+  int64_t scanMinimum(int64_t bound) const {
+    int64_t minimum = (std::numeric_limits<int64_t>::max)();
+    for (int i = 0; i < getMaxSubscribers(); ++i) {
+      if (slots_[i].state.load(std::memory_order_acquire) == detail::kSlotActive) {
+        minimum = (std::min)(minimum, slots_[i].sequence.load(std::memory_order_acquire));
+        if (minimum <= bound) {
+          break;
+        }
+      }
+    }
+    return minimum;
+  }
+
+  void raiseMinimum(int64_t minimum) {
+    if (minimum == (std::numeric_limits<int64_t>::max)()) {
+      return;
+    }
+    int64_t current = header_->minimumSequence.load(std::memory_order_acquire);
+    while (minimum > current &&
+           !header_->minimumSequence.compare_exchange_weak(current, minimum, std::memory_order_release,
+                                                           std::memory_order_acquire)) {
+    }
+  }
+
+  // Activates slot (or the first free one if slot < 0) starting after the
+  // publisher's latest claim. Returns the slot and its starting sequence.
+  std::pair<int, int64_t> join(int slot) {
+    SpinLock lock(*header_);
+    if (slot < 0) {
+      for (int i = 0; i < getMaxSubscribers(); ++i) {
+        if (slots_[i].state.load(std::memory_order_relaxed) == detail::kSlotFree) {
+          slot = i;
+          break;
+        }
+      }
+      if (slot < 0) {
+        throw std::runtime_error("BroadcastRing has no free subscriber slots");
+      }
+    }
+
+    const int32_t activeCount = header_->activeCount.load(std::memory_order_relaxed);
+    header_->activeCount.store(activeCount + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t start = header_->claimed.load(std::memory_order_relaxed);
+    if (activeCount > 0) {
+      start = (std::max)(start, header_->minimumSequence.load(std::memory_order_relaxed));
+    }
+    slots_[slot].sequence.store(start, std::memory_order_relaxed);
+    slots_[slot].state.store(detail::kSlotActive, std::memory_order_release);
+    if (activeCount == 0) {
+      // start is the latest claim, so at or above the stale minimum.
+      raiseMinimum(start);
+    }
+    return {slot, start};
+  }
+
+  void leave(int slot) {
+    SpinLock lock(*header_);
+    const uint32_t state = slots_[slot].state.load(std::memory_order_relaxed);
+    slots_[slot].state.store(detail::kSlotFree, std::memory_order_release);
+    if (state == detail::kSlotActive) {
+      header_->activeCount.fetch_sub(1, std::memory_order_relaxed);
+      recomputeMinimumLocked();
+    }
+  }
+
+  // Called by a subscriber after it moved from previous to sequence. Only a
+  // subscriber that was at the minimum scans, and the scan stops at the
+  // first other subscriber still there, so in the caught-up steady state
+  // only the last one to move scans the whole table.
+  void onSubscriberAdvanced(int slot, int64_t previous, int64_t sequence) {
+    slots_[slot].sequence.store(sequence, std::memory_order_release);
+    // Of two subscribers leaving the minimum together, at least one sees the
+    // other's new sequence, so the minimum is never left behind.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (previous > header_->minimumSequence.load(std::memory_order_acquire)) {
+      return;
+    }
+    const int64_t minimum = scanMinimum(previous);
+    if (minimum > previous) {
+      raiseMinimum(minimum);
+    }
+  }
+};
+
+// One reader of a BroadcastRing. Joins on construction (starting after the
+// publisher's latest claim) and leaves on destruction.
+template <typename E>
+class BroadcastSubscriber final {
+public:
+  enum class PollState { PROCESSING, IDLE, DROPPED };
+
+  explicit BroadcastSubscriber(BroadcastRing<E>& ring) : ring_(&ring) {
+    const auto [slot, start] = ring_->join(-1);
+    slot_ = slot;
+    sequence_ = start;
+  }
+
+  ~BroadcastSubscriber() { ring_->leave(slot_); }
+
+  BroadcastSubscriber(const BroadcastSubscriber&) = delete;
+  BroadcastSubscriber& operator=(const BroadcastSubscriber&) = delete;
+
+  // Hands up to maxBatchSize published events to
+  // handler(const E& event, int64_t sequence, bool endOfBatch).
+  // With BLOCK_PUBLISHER the handler sees the event in place; with
+  // DROP_SUBSCRIBER it sees a copy that was verified not to have been
+  // overwritten while it was read.
+  template <typename Handler>
+  PollState poll(Handler&& handler, int64_t maxBatchSize = (std::numeric_limits<int64_t>::max)()) {
+    auto& slot = ring_->slots_[slot_];
+    if (slot.state.load(std::memory_order_acquire) != detail::kSlotActive) {
+      return PollState::DROPPED;
+    }
+    const int64_t current = sequence_;
+    int64_t available = ring_->getCursor();
+    if (available - current > maxBatchSize) {
+      available = current + (std::max)(maxBatchSize, int64_t{1});
+    }
+    if (available <= current) {
+      return PollState::IDLE;
+    }
+
+    const bool verifyCopies = ring_->getPolicy() == SlowSubscriberPolicy::DROP_SUBSCRIBER;
+    int64_t processed = current;
+    PollState result = PollState::PROCESSING;
+    try {
+      for (int64_t sequence = current + 1; sequence <= available; ++sequence) {
+        if (verifyCopies) {
+          E copy;
+          std::memcpy(static_cast<void*>(&copy), &ring_->get(sequence), sizeof(E));
+          std::atomic_thread_fence(std::memory_order_acquire);
+          if (slot.state.load(std::memory_order_relaxed) != detail::kSlotActive) {
+            result = PollState::DROPPED;
+            break;
+          }
+          handler(static_cast<const E&>(copy), sequence, sequence == available);
+        } else {
+          handler(static_cast<const E&>(ring_->get(sequence)), sequence, sequence == available);
+        }
+        processed = sequence;
+      }
+    } catch (...) {
+      advance(processed);
+      throw;
+    }
+    advance(processed);
+    return result;
+  }
+
+  // After DROPPED: take the slot back, continuing after the publisher's
+  // latest claim. Events in between are lost.
+  void rejoin() {
+    if (ring_->slots_[slot_].state.load(std::memory_order_acquire) == detail::kSlotActive) {
+      return;
+    }
+    sequence_ = ring_->join(slot_).second;
+  }
+
+  int getSlot() const { return slot_; }
+  int64_t getSequence() const { return sequence_; }
+
+private:
+  BroadcastRing<E>* ring_;
+  int slot_;
+  int64_t sequence_;
+
+  void advance(int64_t processed) {
+    if (processed != sequence_) {
+      ring_->onSubscriberAdvanced(slot_, sequence_, processed);
+      sequence_ = processed;
+    }
+  }
+};
+
+} // namespace disruptor::ipc
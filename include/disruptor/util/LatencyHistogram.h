@@ -0,0 +1,152 @@
+#pragma once
+// Lock-free, fixed-footprint latency histogram.
+//
+// HDR-style log-linear bucketing: values below 2 * SUB_BUCKET_COUNT are
+// recorded exactly, larger values keep SUB_BUCKET_BITS of precision
+// (~3% relative error) across the full int64_t range.
+//
+// Threading model:
+// - record() must be called from a single writer thread. It uses relaxed
+//   load/store pairs instead of read-modify-write, so there is no locked
+//   instruction and no allocation on the hot path.
+// - Every accessor may be called from any other thread at any time; readers
+//   observe a slightly stale but never torn view.
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace disruptor::util {
+
+class LatencyHistogram final {
+public:
+  static constexpr int SUB_BUCKET_BITS = 5;
+  static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+  static constexpr int LINEAR_LIMIT = 2 * SUB_BUCKET_COUNT;
+  static constexpr int BUCKET_COUNT =
+      LINEAR_LIMIT + (63 - (SUB_BUCKET_BITS + 1) + 1) * SUB_BUCKET_COUNT;
+
+  LatencyHistogram() { reset(); }
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  // Single writer only. Negative values are clamped to zero.
+  void record(int64_t value) noexcept {
+    const uint64_t v = value < 0 ? 0 : static_cast<uint64_t>(value);
+    auto& bucket = counts_[static_cast<size_t>(bucketIndex(v))];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    sum_.store(sum_.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    if (v > max_.load(std::memory_order_relaxed)) {
+      max_.store(v, std::memory_order_relaxed);
+    }
+    if (v < min_.load(std::memory_order_relaxed)) {
+      min_.store(v, std::memory_order_relaxed);
+    }
+    // Published last so a reader never sees a count without its bucket.
+    totalCount_.store(totalCount_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  // Must not race with record().
+  void reset() noexcept {
+    for (auto& c : counts_) {
+      c.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    totalCount_.store(0, std::memory_order_release);
+  }
+
+  int64_t getTotalCount() const noexcept {
+    return static_cast<int64_t>(totalCount_.load(std::memory_order_acquire));
+  }
+
+  int64_t getMax() const noexcept { return static_cast<int64_t>(max_.load(std::memory_order_relaxed)); }
+
+  int64_t getMin() const noexcept {
+    const uint64_t min = min_.load(std::memory_order_relaxed);
+    return min == std::numeric_limits<uint64_t>::max() ? 0 : static_cast<int64_t>(min);
+  }
+
+  double getMean() const noexcept {
+    const uint64_t count = totalCount_.load(std::memory_order_acquire);
+    return count == 0 ? 0.0
+                      : static_cast<double>(sum_.load(std::memory_order_relaxed)) /
+                            static_cast<double>(count);
+  }
+
+  // Returns the highest value equivalent to the bucket holding the given
+  // percentile (0..100], capped at the recorded maximum.
+  int64_t getValueAtPercentile(double percentile) const noexcept {
+    uint64_t total = 0;
+    for (const auto& c : counts_) {
+      total += c.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+      return 0;
+    }
+    if (percentile > 100.0) {
+      percentile = 100.0;
+    }
+    uint64_t target = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total) + 0.5);
+    if (target == 0) {
+      target = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+      seen += counts_[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+      if (seen >= target) {
+        const uint64_t max = max_.load(std::memory_order_relaxed);
+        const uint64_t upper = highestEquivalentValue(i);
+        return static_cast<int64_t>(upper < max ? upper : max);
+      }
+    }
+    return getMax();
+  }
+
+  int64_t getCountAtIndex(int index) const noexcept {
+    return static_cast<int64_t>(counts_[static_cast<size_t>(index)].load(std::memory_order_relaxed));
+  }
+
+  static int bucketIndex(uint64_t value) noexcept {
+    if (value < static_cast<uint64_t>(LINEAR_LIMIT)) {
+      return static_cast<int>(value);
+    }
+    const int magnitude = 63 - std::countl_zero(value);
+    const int shift = magnitude - SUB_BUCKET_BITS;
+    const int subBucket = static_cast<int>((value >> shift) & (SUB_BUCKET_COUNT - 1));
+    return LINEAR_LIMIT + (magnitude - (SUB_BUCKET_BITS + 1)) * SUB_BUCKET_COUNT + subBucket;
+  }
+
+  static uint64_t lowestEquivalentValue(int index) noexcept {
+    if (index < LINEAR_LIMIT) {
+      return static_cast<uint64_t>(index);
+    }
+    const int magnitude = (index - LINEAR_LIMIT) / SUB_BUCKET_COUNT + SUB_BUCKET_BITS + 1;
+    const int subBucket = (index - LINEAR_LIMIT) % SUB_BUCKET_COUNT;
+    return static_cast<uint64_t>(SUB_BUCKET_COUNT + subBucket) << (magnitude - SUB_BUCKET_BITS);
+  }
+
+  static uint64_t highestEquivalentValue(int index) noexcept {
+    if (index < LINEAR_LIMIT) {
+      return static_cast<uint64_t>(index);
+    }
+    const int magnitude = (index - LINEAR_LIMIT) / SUB_BUCKET_COUNT + SUB_BUCKET_BITS + 1;
+    return lowestEquivalentValue(index) + ((uint64_t{1} << (magnitude - SUB_BUCKET_BITS)) - 1);
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> counts_;
+  alignas(64) std::atomic<uint64_t> totalCount_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> max_{0};
+  std::atomic<uint64_t> min_{std::numeric_limits<uint64_t>::max()};
+};
+
+} // namespace disruptor::util
@@ -0,0 +1,194 @@
+#pragma once
+// Sampled per-sequence latency tracing.
+//
+// Every SAMPLE_RATE-th sequence (a power of two) gets a record in a side ring
+// indexed by sequence, so the event type itself is never modified. Each
+// record holds one timestamp per point in the pipeline:
+//   column 0          - RingBuffer::next/tryNext claimed the sequence
+//   column 1          - RingBuffer::publish made it visible
+//   column 2 + stage  - BatchEventProcessor `stage` finished handling it
+//
+// Writers are the producer (claim/publish, single or multiple producers)
+// and one processor thread per stage; each only touches its own column.
+// report() may run on any thread; records that were recycled while being
+// read, or are not yet complete, are skipped.
+
+#include "LatencyHistogram.h"
+#include "Util.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace disruptor::util {
+
+// Latency breakdown produced by SequenceTracer::report().
+// Segment 0 is claim -> publish, segment 1 is publish -> stage 0, and
+// segment i + 1 is stage i - 1 -> stage i.
+class SequenceTraceReport final {
+public:
+  explicit SequenceTraceReport(int stageCount)
+      : segmentCount_(stageCount + 1),
+        segments_(std::make_unique<LatencyHistogram[]>(static_cast<size_t>(stageCount + 1))),
+        endToEnd_(std::make_unique<LatencyHistogram>()) {}
+
+  int getSegmentCount() const { return segmentCount_; }
+  const LatencyHistogram& getSegment(int segment) const { return segments_[static_cast<size_t>(segment)]; }
+  // claim -> last stage
+  const LatencyHistogram& getEndToEnd() const { return *endToEnd_; }
+  int64_t getSampleCount() const { return endToEnd_->getTotalCount(); }
+
+private:
+  friend class SequenceTracer;
+
+  int segmentCount_;
+  std::unique_ptr<LatencyHistogram[]> segments_;
+  std::unique_ptr<LatencyHistogram> endToEnd_;
+};
+
+class SequenceTracer final {
+public:
+  static constexpr int CLAIM_COLUMN = 0;
+  static constexpr int PUBLISH_COLUMN = 1;
+
+  // capacity: number of sampled records kept (power of two)
+  // sampleRate: trace one sequence in `sampleRate` (power of two)
+  // stageCount: number of processor stages that will call onStage()
+  SequenceTracer(int capacity, int sampleRate, int stageCount)
+      : capacity_(capacity),
+        sampleShift_(sampleRate > 0 ? Util::log2(sampleRate) : 0),
+        sampleMask_(static_cast<int64_t>(sampleRate) - 1),
+        columns_(stageCount + 2),
+        stageCount_(stageCount),
+        tags_(static_cast<size_t>(capacity)),
+        stamps_(static_cast<size_t>(capacity) * static_cast<size_t>(stageCount + 2)) {
+    if (capacity < 1 || (capacity & (capacity - 1)) != 0) {
+      throw std::invalid_argument("capacity must be a power of 2");
+    }
+    if (sampleRate < 1 || (sampleRate & (sampleRate - 1)) != 0) {
+      throw std::invalid_argument("sampleRate must be a power of 2");
+    }
+    if (stageCount < 1) {
+      throw std::invalid_argument("stageCount must be greater than 0");
+    }
+    for (auto& tag : tags_) {
+      tag.store(-1, std::memory_order_relaxed);
+    }
+    for (auto& stamp : stamps_) {
+      stamp.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  SequenceTracer(const SequenceTracer&) = delete;
+  SequenceTracer& operator=(const SequenceTracer&) = delete;
+
+  bool isSampled(int64_t sequence) const noexcept { return (sequence & sampleMask_) == 0; }
+
+  int getStageCount() const noexcept { return stageCount_; }
+
+  // Producer: sequences [lo, hi] were claimed.
+  void onClaim(int64_t lo, int64_t hi) noexcept {
+    int64_t sequence = firstSampledAtOrAfter(lo);
+    if (sequence > hi) {
+      return;
+    }
+    const int64_t now = Util::nanoTime();
+    for (; sequence <= hi; sequence += sampleMask_ + 1) {
+      const size_t record = recordIndex(sequence);
+      auto& tag = tags_[record];
+      // Invalidate, clear the old sample's columns, then retag.
+      tag.store(-1, std::memory_order_relaxed);
+      for (int column = 1; column < columns_; ++column) {
+        stamp(record, column).store(0, std::memory_order_relaxed);
+      }
+      stamp(record, CLAIM_COLUMN).store(now, std::memory_order_relaxed);
+      tag.store(sequence, std::memory_order_release);
+    }
+  }
+
+  // Producer: sequences [lo, hi] were published.
+  void onPublish(int64_t lo, int64_t hi) noexcept {
+    int64_t sequence = firstSampledAtOrAfter(lo);
+    if (sequence > hi) {
+      return;
+    }
+    const int64_t now = Util::nanoTime();
+    for (; sequence <= hi; sequence += sampleMask_ + 1) {
+      markColumn(sequence, PUBLISH_COLUMN, now);
+    }
+  }
+
+  // Processor thread of `stage`: finished handling `sequence`.
+  void onStage(int stage, int64_t sequence) noexcept {
+    if (isSampled(sequence)) {
+      markColumn(sequence, 2 + stage, Util::nanoTime());
+    }
+  }
+
+  // Builds the stage-by-stage breakdown from all complete records.
+  SequenceTraceReport report() const {
+    SequenceTraceReport result(stageCount_);
+    std::vector<int64_t> snapshot(static_cast<size_t>(columns_));
+
+    for (size_t record = 0; record < tags_.size(); ++record) {
+      const int64_t tagBefore = tags_[record].load(std::memory_order_acquire);
+      if (tagBefore < 0) {
+        continue;
+      }
+      bool complete = true;
+      for (int column = 0; column < columns_; ++column) {
+        const int64_t value = stamp(record, column).load(std::memory_order_relaxed);
+        snapshot[static_cast<size_t>(column)] = value;
+        // A late stamp from a recycled sample shows up as time going backwards.
+        complete = complete && value != 0 && (column == 0 || value >= snapshot[static_cast<size_t>(column - 1)]);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (!complete || tags_[record].load(std::memory_order_relaxed) != tagBefore) {
+        continue;
+      }
+
+      for (int segment = 0; segment < result.segmentCount_; ++segment) {
+        result.segments_[static_cast<size_t>(segment)].record(
+            snapshot[static_cast<size_t>(segment + 1)] - snapshot[static_cast<size_t>(segment)]);
+      }
+      result.endToEnd_->record(snapshot[static_cast<size_t>(columns_ - 1)] - snapshot[CLAIM_COLUMN]);
+    }
+    return result;
+  }
+
+private:
+  int capacity_;
+  int sampleShift_;
+  int64_t sampleMask_;
+  int columns_;
+  int stageCount_;
+  std::vector<std::atomic<int64_t>> tags_;
+  std::vector<std::atomic<int64_t>> stamps_;
+
+  int64_t firstSampledAtOrAfter(int64_t sequence) const noexcept {
+    return (sequence + sampleMask_) & ~sampleMask_;
+  }
+
+  size_t recordIndex(int64_t sequence) const noexcept {
+    return static_cast<size_t>((sequence >> sampleShift_) & (capacity_ - 1));
+  }
+
+  std::atomic<int64_t>& stamp(size_t record, int column) noexcept {
+    return stamps_[record * static_cast<size_t>(columns_) + static_cast<size_t>(column)];
+  }
+  const std::atomic<int64_t>& stamp(size_t record, int column) const noexcept {
+    return stamps_[record * static_cast<size_t>(columns_) + static_cast<size_t>(column)];
+  }
+
+  void markColumn(int64_t sequence, int column, int64_t now) noexcept {
+    const size_t record = recordIndex(sequence);
+    // Skip if the record has already been recycled for a later sample.
+    if (tags_[record].load(std::memory_order_acquire) == sequence) {
+      stamp(record, column).store(now, std::memory_order_relaxed);
+    }
+  }
+};
+
+} // namespace disruptor::util
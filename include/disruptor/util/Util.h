@@ -77,6 +77,12 @@ public:
     return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
   }
 
+  // Java: System.nanoTime() - monotonic, only meaningful as a difference.
+  static int64_t nanoTime() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+  }
+
   static std::vector<disruptor::Sequence*> getSequencesFor(
       const std::vector<disruptor::EventProcessor*>& processors) {
     std::vector<disruptor::Sequence*> sequences;
@@ -0,0 +1,71 @@
+#include "FrameSnapshotBuffer.h"
+
+namespace {
+
+// 缓冲区按缓存行对齐，避免相邻缓冲区的首尾共享缓存行
+constexpr size_t kCacheLineSize = 64;
+
+size_t AlignToCacheLine(size_t size) {
+    return (size + kCacheLineSize - 1) & ~(kCacheLineSize - 1);
+}
+
+}  // namespace
+
+FrameSnapshotBuffer::FrameSnapshotBuffer(size_t capacity)
+    : capacity_(AlignToCacheLine(capacity == 0 ? kDefaultCapacity : capacity)) {
+    // 预分配三个缓冲区
+    storage_.resize(capacity_ * kBufferCount);
+}
+
+std::span<uint8_t> FrameSnapshotBuffer::BeginWrite() {
+    return std::span<uint8_t>(storage_).subspan(back_ * capacity_, capacity_);
+}
+
+bool FrameSnapshotBuffer::Publish(size_t size, uint64_t frame_id) {
+    if (size > capacity_) {
+        return false;
+    }
+
+    frames_[back_].size = size;
+    frames_[back_].frame_id = frame_id;
+
+    // 一次原子交换：后台缓冲区成为 middle，旧 middle 成为新的后台缓冲区
+    uint32_t previous = state_.exchange(back_ | kDirtyBit, std::memory_order_acq_rel);
+    back_ = previous & kIndexMask;
+
+    published_count_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool FrameSnapshotBuffer::AcquireLatest(Snapshot* snapshot) {
+    if (!snapshot) {
+        return false;
+    }
+
+    bool updated = false;
+    if (state_.load(std::memory_order_relaxed) & kDirtyBit) {
+        // 取走最新帧，把已读完的 front 还给生产者
+        uint32_t previous = state_.exchange(front_, std::memory_order_acq_rel);
+        front_ = previous & kIndexMask;
+        has_frame_ = true;
+        updated = true;
+    }
+
+    if (!has_frame_) {
+        return false;
+    }
+
+    const FrameInfo& info = frames_[front_];
+    snapshot->data = std::span<const uint8_t>(storage_).subspan(front_ * capacity_, info.size);
+    snapshot->frame_id = info.frame_id;
+    snapshot->updated = updated;
+    return true;
+}
+
+size_t FrameSnapshotBuffer::GetCapacity() const {
+    return capacity_;
+}
+
+uint64_t FrameSnapshotBuffer::GetPublishedCount() const {
+    return published_count_.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * 无锁三缓冲帧快照区（单生产者 / 单消费者）
+ *
+ * 设计特点：
+ * - 模拟线程把整帧实体状态写入后台缓冲区，通过一次原子交换发布
+ * - Unity 总是读取最新的完整帧，中间帧被直接覆盖，不需要逐条解析消息
+ * - 三个缓冲区轮换：生产者持有 back，消费者持有 front，middle 为最近发布的帧
+ * - 双方都不会等待对方，写入和读取都不加锁
+ *
+ * 线程模型：
+ * - BeginWrite / Publish 只能由一个写线程调用
+ * - AcquireLatest 只能由一个读线程调用，返回的数据在下一次 AcquireLatest 前有效
+ */
+class FrameSnapshotBuffer {
+ public:
+    static constexpr size_t kDefaultCapacity = 1024 * 1024;  // 每个缓冲区 1MB
+    static constexpr size_t kBufferCount = 3;
+
+    // 读取到的快照
+    struct Snapshot {
+        std::span<const uint8_t> data;
+        uint64_t frame_id{0};
+        bool updated{false};  // 自上次读取以来是否有新帧
+    };
+
+    /**
+     * 构造函数
+     * @param capacity 单个缓冲区容量（按缓存行向上对齐），运行时不可改变
+     */
+    explicit FrameSnapshotBuffer(size_t capacity = kDefaultCapacity);
+
+    ~FrameSnapshotBuffer() = default;
+
+    // 禁用拷贝和移动
+    FrameSnapshotBuffer(const FrameSnapshotBuffer&) = delete;
+    FrameSnapshotBuffer& operator=(const FrameSnapshotBuffer&) = delete;
+    FrameSnapshotBuffer(FrameSnapshotBuffer&&) = delete;
+    FrameSnapshotBuffer& operator=(FrameSnapshotBuffer&&) = delete;
+
+    /**
+     * 获取后台缓冲区 - 写线程在其中原地序列化整帧状态
+     * @return 可写内存，大小为单个缓冲区容量
+     */
+    std::span<uint8_t> BeginWrite();
+
+    /**
+     * 发布后台缓冲区 - 一次原子交换，使其成为最新帧
+     * @param size 实际写入的字节数
+     * @param frame_id 帧号
+     * @return false 表示 size 超过容量，未发布
+     */
+    bool Publish(size_t size, uint64_t frame_id);
+
+    /**
+     * 获取最新的完整帧
+     * @param snapshot 返回快照
+     * @return false 表示尚未发布过任何帧
+     */
+    bool AcquireLatest(Snapshot* snapshot);
+
+    /**
+     * 获取单个缓冲区容量
+     * @return 单个缓冲区容量
+     */
+    size_t GetCapacity() const;
+
+    /**
+     * 获取已发布的帧数
+     * @return 已发布的帧数
+     */
+    uint64_t GetPublishedCount() const;
+
+ private:
+    // state_ 低两位为 middle 索引，kDirtyBit 表示 middle 中有消费者未取走的新帧
+    static constexpr uint32_t kIndexMask = 0x3;
+    static constexpr uint32_t kDirtyBit = 0x4;
+
+    // 每个缓冲区的帧信息（由生产者在发布前写入，消费者在交换后读取）
+    struct FrameInfo {
+        size_t size{0};
+        uint64_t frame_id{0};
+    };
+
+    // 缓存行对齐，避免伪共享
+    alignas(64) std::atomic<uint32_t> state_{1};  // 初始 middle = 1，无新帧
+    alignas(64) uint32_t back_{0};                // 生产者独占
+    alignas(64) uint32_t front_{2};  // 消费者独占
+    bool has_frame_{false};
+
+    std::vector<uint8_t> storage_;  // 三个缓冲区连续存放
+    const size_t capacity_;
+    FrameInfo frames_[kBufferCount];
+    std::atomic<uint64_t> published_count_{0};
+};
@@ -2,72 +2,264 @@
 
 #include <algorithm>
 #include <bit>
+#include <cstdint>
 #include <cstring>
 #include <span>
+#include <thread>
 
-RingBuffer::RingBuffer(size_t capacity)
+namespace {
+
+// 实例编号分配器
+std::atomic<uint64_t> g_next_instance_id{1};
+
+// 按序提交时自旋多少次后让出 CPU
+constexpr int kCommitSpinTries = 64;
+
+}  // namespace
+
+RingBuffer::RingBuffer(size_t capacity, ProducerMode mode)
     : capacity_(std::min(NextPowerOfTwo(std::max(capacity, kMinCapacity)), kMaxCapacity))
-    , mask_(capacity_ - 1) {
+    , mask_(capacity_ - 1)
+    , mode_(mode)
+    , instance_id_(g_next_instance_id.fetch_add(1, std::memory_order_relaxed)) {
     // 预分配固定大小的缓冲区（借鉴 Disruptor 策略）
     buffer_.resize(capacity_);
 }
 
-RingBuffer::Error RingBuffer::Write(const std::string& data) {
+RingBuffer::Error RingBuffer::Write(std::span<const uint8_t> data) {
     if (data.empty()) {
         return Error::kSuccess;
     }
 
-    if (data.size() > kMaxCapacity) {
-        failed_writes_.fetch_add(1, std::memory_order_relaxed);
+    WriteReservation reservation;
+    Error result = ReserveRange(data.size(), &reservation);
+    if (result != Error::kSuccess) {
+        return result;
+    }
+
+    // 最多两次 memcpy（环绕时）
+    std::memcpy(reservation.first.data(), data.data(), reservation.first.size());
+    if (!reservation.second.empty()) {
+        std::memcpy(reservation.second.data(),
+                    data.subspan(reservation.first.size()).data(),
+                    reservation.second.size());
+    }
+
+    return Commit(reservation);
+}
+
+RingBuffer::Error RingBuffer::Write(std::string_view data) {
+    return Write(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(data.data()),
+                                          data.size()));
+}
+
+RingBuffer::Error RingBuffer::Reserve(size_t size, WriteReservation* reservation) {
+    // kMulti：预留区间必须能容纳一条跳过记录，Abort 时才能保持读端帧格式
+    if (mode_ == ProducerMode::kMulti && size < kSkipHeaderSize) {
+        AddOwned(LocalWriterStats().failed_writes, 1);
         return Error::kInvalidArgument;
     }
 
-    // 检查是否有足够空间
-    size_t current_tail = tail_.load(std::memory_order_acquire);
-    size_t current_head = head_.load(std::memory_order_acquire);
-    size_t available_space;
+    return ReserveRange(size, reservation);
+}
 
-    if (current_tail >= current_head) {
-        available_space = capacity_ - (current_tail - current_head) - 1;
-    } else {
-        available_space = current_head - current_tail - 1;
+RingBuffer::Error RingBuffer::ReserveRange(size_t size, WriteReservation* reservation) {
+    if (!reservation || size == 0 || size > kMaxCapacity) {
+        AddOwned(LocalWriterStats().failed_writes, 1);
+        return Error::kInvalidArgument;
     }
 
-    if (data.size() > available_space) {
+    // kSingle：上一次预留尚未 Commit/Abort 时拒绝，避免返回同一段区间
+    if (mode_ == ProducerMode::kSingle && single_reserved_) {
+        AddOwned(LocalWriterStats().failed_writes, 1);
+        return Error::kInvalidArgument;
+    }
+
+    size_t start = 0;
+    bool claimed = mode_ == ProducerMode::kMulti ? ClaimMulti(size, &start)
+                                                 : ClaimSingle(size, &start);
+    if (!claimed) {
         // 固定大小设计：空间不足时直接返回错误（借鉴 Disruptor 策略）
-        failed_writes_.fetch_add(1, std::memory_order_relaxed);
+        AddOwned(LocalWriterStats().failed_writes, 1);
         return Error::kInsufficientCapacity;
     }
 
-    // 执行写入操作
-    size_t write_pos = current_tail;
-    const uint8_t* src_data = reinterpret_cast<const uint8_t*>(data.data());
+    auto buffer_span = std::span<uint8_t>(buffer_);
+    size_t first_part = std::min(size, capacity_ - start);
+    reservation->first = buffer_span.subspan(start, first_part);
+    reservation->second = buffer_span.subspan(0, size - first_part);
+    reservation->start = start;
+    reservation->size = size;
+    if (mode_ == ProducerMode::kSingle) {
+        single_reserved_ = true;
+    }
+
+    return Error::kSuccess;
+}
+
+RingBuffer::Error RingBuffer::Commit(const WriteReservation& reservation) {
+    if (reservation.size == 0 || reservation.start >= capacity_) {
+        return Error::kInvalidArgument;
+    }
 
+    if (mode_ == ProducerMode::kMulti) {
+        // 按预留顺序推进 tail_，保证读端看到的数据连续且完整
+        CommitInOrder(reservation.start, reservation.size);
+    } else {
+        if (!single_reserved_) {
+            return Error::kInvalidArgument;
+        }
+        single_reserved_ = false;
+        tail_.store((reservation.start + reservation.size) & mask_, std::memory_order_release);
+    }
+
+    // 更新统计信息
+    AddOwned(LocalWriterStats().writes, 1);
+
+    return Error::kSuccess;
+}
+
+RingBuffer::Error RingBuffer::Abort(const WriteReservation& reservation) {
+    if (reservation.size == 0 || reservation.start >= capacity_) {
+        return Error::kInvalidArgument;
+    }
+
+    if (mode_ == ProducerMode::kMulti) {
+        // 区间已被 claim_ 占用，不能收回：填充为跳过记录后照常按序提交
+        FillSkipRecords(reservation.start, reservation.size);
+        CommitInOrder(reservation.start, reservation.size);
+    } else {
+        if (!single_reserved_) {
+            return Error::kInvalidArgument;
+        }
+        // tail_ 未推进，释放预留即可
+        single_reserved_ = false;
+    }
+
+    AddOwned(LocalWriterStats().failed_writes, 1);
+
+    return Error::kSuccess;
+}
+
+bool RingBuffer::ClaimSingle(size_t size, size_t* start) {
+    size_t current_tail = tail_.load(std::memory_order_relaxed);
+    size_t current_head = head_.load(std::memory_order_acquire);
+
+    if (size > AvailableSpace(current_head, current_tail)) {
+        return false;
+    }
+
+    *start = current_tail;
+    return true;
+}
+
+bool RingBuffer::ClaimMulti(size_t size, size_t* start) {
+    // 以未取模的 claim_ 做 CAS，空间按 head_（读端已释放位置）计算
+    uint64_t claim = claim_.load(std::memory_order_relaxed);
+    do {
+        size_t current_head = head_.load(std::memory_order_acquire);
+        if (size > AvailableSpace(current_head, static_cast<size_t>(claim) & mask_)) {
+            return false;
+        }
+    } while (!claim_.compare_exchange_weak(
+        claim, claim + size, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    *start = static_cast<size_t>(claim) & mask_;
+    return true;
+}
+
+void RingBuffer::CopyIn(size_t pos, const uint8_t* data, size_t size) {
     // 使用 span 避免指针算术
     auto buffer_span = std::span<uint8_t>(buffer_);
-    auto src_span = std::span<const uint8_t>(src_data, data.size());
+    auto src_span = std::span<const uint8_t>(data, size);
 
-    if (write_pos + data.size() <= capacity_) {
+    if (pos + size <= capacity_) {
         // 不需要环绕
-        std::memcpy(
-            buffer_span.subspan(write_pos, data.size()).data(), src_span.data(), data.size());
+        std::memcpy(buffer_span.subspan(pos, size).data(), src_span.data(), size);
     } else {
         // 需要环绕
-        size_t first_part = capacity_ - write_pos;
-        std::memcpy(buffer_span.subspan(write_pos, first_part).data(), src_span.data(), first_part);
-        std::memcpy(buffer_span.subspan(0, data.size() - first_part).data(),
+        size_t first_part = capacity_ - pos;
+        std::memcpy(buffer_span.subspan(pos, first_part).data(), src_span.data(), first_part);
+        std::memcpy(buffer_span.subspan(0, size - first_part).data(),
                     src_span.subspan(first_part).data(),
-                    data.size() - first_part);
+                    size - first_part);
     }
+}
 
-    // 原子地更新尾部指针
-    size_t new_tail = (write_pos + data.size()) & mask_;
-    tail_.store(new_tail, std::memory_order_release);
+void RingBuffer::FillSkipRecords(size_t pos, size_t size) {
+    constexpr size_t kMaxRecordSize = kSkipHeaderSize + UINT16_MAX;
+    while (size > 0) {
+        // 单条记录的消息体不超过 uint16_t；剩余部分不足一个消息头时缩短本条记录
+        size_t record = std::min(size, kMaxRecordSize);
+        if (size - record != 0 && size - record < kSkipHeaderSize) {
+            record -= kSkipHeaderSize;
+        }
+
+        const uint16_t bodySize = static_cast<uint16_t>(record - kSkipHeaderSize);
+        uint8_t header[kSkipHeaderSize];
+        std::memcpy(header, &bodySize, sizeof(uint16_t));
+        std::memcpy(header + sizeof(uint16_t), &kSkipMessageId, sizeof(uint16_t));
+        CopyIn(pos, header, kSkipHeaderSize);
+
+        pos = (pos + record) & mask_;
+        size -= record;
+    }
+}
 
-    // 更新统计信息
-    total_writes_.fetch_add(1, std::memory_order_relaxed);
+void RingBuffer::CommitInOrder(size_t start, size_t size) {
+    // 前序预留尚未提交时等待（前序写线程只剩拷贝，等待时间很短）
+    int tries = 0;
+    while (tail_.load(std::memory_order_acquire) != start) {
+        if (++tries >= kCommitSpinTries) {
+            std::this_thread::yield();
+            tries = 0;
+        }
+    }
+    tail_.store((start + size) & mask_, std::memory_order_release);
+}
 
-    return Error::kSuccess;
+size_t RingBuffer::AvailableSpace(size_t head, size_t tail) const {
+    // 保留一个字节区分空和满
+    return capacity_ - ((tail - head) & mask_) - 1;
+}
+
+RingBuffer::WriterStats& RingBuffer::LocalWriterStats() {
+    struct CacheEntry {
+        uint64_t instance_id = 0;
+        WriterStats* stats = nullptr;
+    };
+    thread_local std::array<CacheEntry, kWriterStatsCacheSize> cache{};
+    thread_local size_t next_victim = 0;
+
+    for (const CacheEntry& entry : cache) {
+        if (entry.instance_id == instance_id_) {
+            return *entry.stats;
+        }
+    }
+
+    // 未命中：按线程 id 查找已登记的统计块，没有则登记一个
+    WriterStats* stats = nullptr;
+    {
+        const std::thread::id self = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(writer_stats_mutex_);
+        for (const auto& [owner, owned] : writer_stats_) {
+            if (owner == self) {
+                stats = owned.get();
+                break;
+            }
+        }
+        if (!stats) {
+            writer_stats_.emplace_back(self, std::make_unique<WriterStats>());
+            stats = writer_stats_.back().second.get();
+        }
+    }
+    cache[next_victim] = CacheEntry{instance_id_, stats};
+    next_victim = (next_victim + 1) % kWriterStatsCacheSize;
+    return *stats;
+}
+
+void RingBuffer::AddOwned(std::atomic<size_t>& counter, size_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
 }
 
 RingBuffer::Error RingBuffer::PrepareWrite(size_t* head, size_t* tail) {
@@ -75,6 +267,11 @@ RingBuffer::Error RingBuffer::PrepareWrite(size_t* head, size_t* tail) {
         return Error::kInvalidArgument;
     }
 
+    // 外部直接写入绕过 claim_，只能用于单写线程模式
+    if (mode_ == ProducerMode::kMulti) {
+        return Error::kInvalidArgument;
+    }
+
     // 获取当前头尾状态
     *head = head_.load(std::memory_order_acquire);
     *tail = tail_.load(std::memory_order_acquire);
@@ -82,12 +279,16 @@ RingBuffer::Error RingBuffer::PrepareWrite(size_t* head, size_t* tail) {
     return Error::kSuccess;
 }
 
-RingBuffer::Error RingBuffer::CommitWrite(size_t new_tail) {
+RingBuffer::Error RingBuffer::CommitWrite(size_t new_tail, size_t write_count) {
+    if (mode_ == ProducerMode::kMulti || new_tail >= capacity_) {
+        return Error::kInvalidArgument;
+    }
+
     // 原子地更新尾指针（写入操作只需要更新尾指针）
     tail_.store(new_tail, std::memory_order_release);
 
     // 更新统计信息
-    total_writes_.fetch_add(1, std::memory_order_relaxed);
+    AddOwned(LocalWriterStats().writes, write_count);
 
     return Error::kSuccess;
 }
@@ -97,38 +298,13 @@ size_t RingBuffer::DoWrite(const void* data, size_t size, size_t head, size_t* t
         return 0;
     }
 
-    // 检查是否有足够空间
-    size_t available_space;
-    if (*tail >= head) {
-        available_space = capacity_ - (*tail - head) - 1;
-    } else {
-        available_space = head - *tail - 1;
-    }
-
-    if (size > available_space) {
+    if (size > AvailableSpace(head, *tail)) {
         // 固定大小设计：空间不足时直接返回 0（借鉴 Disruptor 策略）
         return 0;
     }
 
     // 执行写入（处理环绕）
-    auto buffer_span = std::span<uint8_t>(buffer_);
-    const uint8_t* src_data = static_cast<const uint8_t*>(data);
-    size_t write_pos = *tail;
-
-    if (write_pos + size <= capacity_) {
-        // 不需要环绕：直接写入
-        auto dest_span = buffer_span.subspan(write_pos, size);
-        std::memcpy(dest_span.data(), src_data, size);
-    } else {
-        // 需要环绕：分两次写入
-        size_t first_part = capacity_ - write_pos;
-        auto first_dest_span = buffer_span.subspan(write_pos, first_part);
-        auto second_dest_span = buffer_span.subspan(0, size - first_part);
-        std::memcpy(first_dest_span.data(), src_data, first_part);
-        auto src_span = std::span<const uint8_t>(src_data, size);
-        std::memcpy(
-            second_dest_span.data(), src_span.subspan(first_part).data(), size - first_part);
-    }
+    CopyIn(*tail, static_cast<const uint8_t*>(data), size);
 
     // 更新本地尾位置
     *tail = (*tail + size) & mask_;
@@ -137,53 +313,76 @@ size_t RingBuffer::DoWrite(const void* data, size_t size, size_t head, size_t* t
 }
 
 std::string RingBuffer::ReadAll() {
-    size_t current_head = head_.load(std::memory_order_acquire);
-    size_t current_tail = tail_.load(std::memory_order_acquire);
-
-    if (current_head == current_tail) {
+    ReadRegion region = PeekRead();
+    if (region.empty()) {
         return {};  // 缓冲区为空
     }
 
-    size_t data_size;
-    if (current_tail > current_head) {
-        data_size = current_tail - current_head;
-    } else {
-        data_size = capacity_ - current_head + current_tail;
+    std::string result;
+    result.reserve(region.size());
+    result.assign(reinterpret_cast<const char*>(region.first.data()), region.first.size());
+    result.append(reinterpret_cast<const char*>(region.second.data()), region.second.size());
+
+    ConsumeRead(region.size());
+
+    return result;
+}
+
+RingBuffer::ReadRegion RingBuffer::PeekRead() const {
+    return GetRegion(head_.load(std::memory_order_relaxed), tail_.load(std::memory_order_acquire));
+}
+
+RingBuffer::ReadRegion RingBuffer::GetRegion(size_t begin, size_t end) const {
+    ReadRegion region;
+    if (begin >= capacity_ || end >= capacity_) {
+        return region;
     }
 
-    std::string result;
-    result.reserve(data_size);
+    size_t data_size = (end - begin) & mask_;
+    if (data_size == 0) {
+        return region;
+    }
 
     // 使用 span 避免指针算术
     auto buffer_span = std::span<const uint8_t>(buffer_);
+    size_t first_part = std::min(data_size, capacity_ - begin);
+    region.first = buffer_span.subspan(begin, first_part);
+    region.second = buffer_span.subspan(0, data_size - first_part);
 
-    if (current_head + data_size <= capacity_) {
-        // 不需要环绕
-        auto data_span = buffer_span.subspan(current_head, data_size);
-        result.assign(reinterpret_cast<const char*>(data_span.data()), data_size);
-    } else {
-        // 需要环绕
-        size_t first_part = capacity_ - current_head;
-        auto first_span = buffer_span.subspan(current_head, first_part);
-        auto second_span = buffer_span.subspan(0, data_size - first_part);
-        result.assign(reinterpret_cast<const char*>(first_span.data()), first_part);
-        result.append(reinterpret_cast<const char*>(second_span.data()), data_size - first_part);
+    return region;
+}
+
+RingBuffer::Error RingBuffer::ConsumeRead(size_t size) {
+    size_t current_head = head_.load(std::memory_order_relaxed);
+    size_t current_tail = tail_.load(std::memory_order_acquire);
+
+    if (size > ((current_tail - current_head) & mask_)) {
+        failed_reads_.fetch_add(1, std::memory_order_relaxed);
+        return Error::kInvalidArgument;
+    }
+    if (size == 0) {
+        return Error::kSuccess;
     }
 
     // 原子地更新头部指针
-    head_.store(current_tail, std::memory_order_release);
+    head_.store((current_head + size) & mask_, std::memory_order_release);
 
     // 更新统计信息
     total_reads_.fetch_add(1, std::memory_order_relaxed);
 
-    return result;
+    return Error::kSuccess;
 }
 
 RingBuffer::Statistics RingBuffer::GetStatistics() const {
     Statistics stats;
-    stats.total_writes = total_writes_.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(writer_stats_mutex_);
+        for (const auto& [owner, owned] : writer_stats_) {
+            stats.total_writes += owned->writes.load(std::memory_order_relaxed);
+            stats.failed_writes += owned->failed_writes.load(std::memory_order_relaxed);
+        }
+    }
     stats.total_reads = total_reads_.load(std::memory_order_relaxed);
-    stats.failed_writes = failed_writes_.load(std::memory_order_relaxed);
     stats.failed_reads = failed_reads_.load(std::memory_order_relaxed);
 
     // 计算当前可读数据大小
@@ -226,9 +425,17 @@ size_t RingBuffer::GetTail() const {
     return tail_.load(std::memory_order_acquire);
 }
 
+RingBuffer::ProducerMode RingBuffer::GetProducerMode() const {
+    return mode_;
+}
+
 RingBuffer::Error RingBuffer::CommitRead(size_t new_head) {
-    // 验证参数
-    if (new_head >= capacity_) {
+    // 验证参数：new_head 必须位于 [head_, tail_] 之间，过期或错误的位置会让 head_ 越过 tail_
+    size_t current_head = head_.load(std::memory_order_relaxed);
+    size_t current_tail = tail_.load(std::memory_order_acquire);
+    if (new_head >= capacity_ ||
+        ((new_head - current_head) & mask_) > ((current_tail - current_head) & mask_)) {
+        failed_reads_.fetch_add(1, std::memory_order_relaxed);
         return Error::kInvalidArgument;
     }
 
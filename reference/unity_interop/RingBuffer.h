@@ -1,14 +1,20 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 /**
- * 高性能线程安全环形缓冲区
+ * 高性能无锁环形缓冲区（单消费者）
  *
  * 设计特点（借鉴 Disruptor 设计哲学）：
  * - 无锁设计，使用原子操作保证线程安全
@@ -16,6 +22,12 @@
  * - 缓存行对齐，避免伪共享
  * - 零拷贝操作，性能优异
  * - 简单易用，维护成本低
+ *
+ * 线程模型：
+ * - ProducerMode::kSingle：只允许一个写线程（Unity 直接写入的输入缓冲区即此模式）
+ * - ProducerMode::kMulti：多个写线程通过 CAS 预留 claim_ 区间，拷贝完成后按预留顺序
+ *   推进提交游标 tail_，读端（Unity）只看到已提交的完整数据
+ * - 两种模式都只允许一个读线程推进 head_
  */
 class RingBuffer {
  public:
@@ -24,6 +36,11 @@ class RingBuffer {
     static constexpr size_t kMaxCapacity = 16 * 1024 * 1024;     // 16MB 最大容量
     static constexpr size_t kMinCapacity = 1024 * 1024;          // 1MB 最小容量
 
+    // 跳过记录（Abort 填充放弃的预留区间）：消息头格式与 UnityBattleContext 一致
+    // （2字节消息体大小 + 2字节消息ID），消息ID为 kSkipMessageId，读端整条跳过
+    static constexpr size_t kSkipHeaderSize = sizeof(uint16_t) * 2;
+    static constexpr uint16_t kSkipMessageId = 0xFFFF;
+
     // 错误码（简化，移除扩容相关错误）
     enum class Error {
         kSuccess = 0,
@@ -32,6 +49,12 @@ class RingBuffer {
         kBufferFull = 3
     };
 
+    // 生产者模式
+    enum class ProducerMode {
+        kSingle = 0,  // 单写线程，直接推进 tail_
+        kMulti = 1    // 多写线程，CAS 预留 + 按序提交
+    };
+
     // 统计信息（简化，移除扩容相关统计）
     struct Statistics {
         size_t total_writes{0};
@@ -41,11 +64,34 @@ class RingBuffer {
         size_t current_size{0};
     };
 
+    // 写入预留：环绕时数据区分为 first/second 两段，序列化器直接写入其中
+    struct WriteReservation {
+        std::span<uint8_t> first;
+        std::span<uint8_t> second;
+        size_t start{0};  // 预留起始位置（已取模）
+        size_t size{0};   // 预留总大小
+    };
+
+    // 可读区域：环绕时分为 first/second 两段，指向缓冲区内存，不拷贝
+    struct ReadRegion {
+        std::span<const uint8_t> first;
+        std::span<const uint8_t> second;
+
+        size_t size() const {
+            return first.size() + second.size();
+        }
+        bool empty() const {
+            return first.empty() && second.empty();
+        }
+    };
+
     /**
      * 构造函数（借鉴 Disruptor 预分配策略）
      * @param capacity 固定容量，必须是2的幂次，运行时不可改变
+     * @param mode 生产者模式，多个模拟线程共同写入时使用 ProducerMode::kMulti
      */
-    explicit RingBuffer(size_t capacity = kDefaultCapacity);
+    explicit RingBuffer(size_t capacity = kDefaultCapacity,
+                        ProducerMode mode = ProducerMode::kSingle);
 
     /**
      * 析构函数
@@ -59,14 +105,48 @@ class RingBuffer {
     RingBuffer& operator=(RingBuffer&&) = delete;
 
     /**
-     * 写入数据 - 线程安全
+     * 写入数据 - kSingle 模式下只能由一个线程调用，kMulti 模式下可多线程并发调用
+     * 两种模式都接受任意非空大小（kSkipHeaderSize 下限只作用于 Reserve）
      * @param data 要写入的数据
      * @return Error::kSuccess 成功，其他值表示失败
      */
-    Error Write(const std::string& data);
+    Error Write(std::span<const uint8_t> data);
+
+    /**
+     * 写入数据（字符串视图重载，避免调用方构造 std::string）
+     * @param data 要写入的数据
+     * @return Error::kSuccess 成功，其他值表示失败
+     */
+    Error Write(std::string_view data);
+
+    /**
+     * 预留写入区间 - 返回一到两段可写内存，调用方原地序列化后必须调用 Commit 或 Abort
+     * kSingle 模式下同一时刻只能有一个未结束的预留，第二次 Reserve 返回 kInvalidArgument；
+     * kMulti 模式下未结束的预留会阻塞后续提交，且预留大小不能小于 kSkipHeaderSize
+     * @param size 预留大小
+     * @param reservation 返回预留区间
+     * @return Error::kSuccess 成功，其他值表示失败
+     */
+    Error Reserve(size_t size, WriteReservation* reservation);
 
     /**
-     * 准备写入 - 获取当前头尾状态
+     * 提交预留区间 - 使读端可见
+     * @param reservation Reserve 返回的预留区间
+     * @return Error::kSuccess 成功，其他值表示失败
+     */
+    Error Commit(const WriteReservation& reservation);
+
+    /**
+     * 放弃预留区间（序列化失败时调用）
+     * kSingle 模式下直接释放预留；kMulti 模式下把区间填充为跳过记录并按序提交，
+     * 后续写线程的提交不会被阻塞，读端跳过该区间
+     * @param reservation Reserve 返回的预留区间
+     * @return Error::kSuccess 成功，其他值表示失败
+     */
+    Error Abort(const WriteReservation& reservation);
+
+    /**
+     * 准备写入 - 获取当前头尾状态（仅 kSingle 模式，kMulti 模式返回 kInvalidArgument）
      * @param head 返回当前头位置
      * @param tail 返回当前尾位置
      * @return Error::kSuccess 成功，其他值表示失败
@@ -86,25 +166,47 @@ class RingBuffer {
     /**
      * 提交写入 - 提交最终的尾位置
      * @param new_tail 新的尾位置
+     * @param write_count 本次提交包含的消息数（批量提交时计入统计）
      * @return Error::kSuccess 成功，其他值表示失败
      */
-    Error CommitWrite(size_t new_tail);
+    Error CommitWrite(size_t new_tail, size_t write_count = 1);
 
     /**
      * 提交读取 - 更新头位置（用于 C# 端读取后更新）
-     * @param new_head 新的头位置
+     * @param new_head 新的头位置，必须位于当前头尾位置之间（含两端）
      * @return Error::kSuccess 成功，其他值表示失败
      */
     Error CommitRead(size_t new_head);
 
     /**
-     * 读取所有可用数据 - 线程安全
+     * 读取所有可用数据 - 仅限读线程调用
      * @return 读取的数据，空字符串表示没有数据
      */
     std::string ReadAll();
 
     /**
-     * 获取统计信息
+     * 查看当前可读区域（不拷贝、不推进 head_）- 仅限读线程调用
+     * @return 可读区域，处理完成后调用 ConsumeRead 释放
+     */
+    ReadRegion PeekRead() const;
+
+    /**
+     * 获取缓冲区中 [begin, end) 的内存视图（位置已取模，end 可小于 begin 表示环绕）
+     * @param begin 起始位置
+     * @param end 结束位置
+     * @return 对应区域，位置非法时返回空区域
+     */
+    ReadRegion GetRegion(size_t begin, size_t end) const;
+
+    /**
+     * 释放已处理的数据 - 推进 head_
+     * @param size 释放大小，不能超过 PeekRead 返回的大小
+     * @return Error::kSuccess 成功，其他值表示失败
+     */
+    Error ConsumeRead(size_t size);
+
+    /**
+     * 获取统计信息（汇总各写线程的本地计数）
      * @return 统计信息结构
      */
     Statistics GetStatistics() const;
@@ -133,22 +235,95 @@ class RingBuffer {
      */
     size_t GetTail() const;
 
+    /**
+     * 获取生产者模式
+     * @return 构造时指定的生产者模式
+     */
+    ProducerMode GetProducerMode() const;
+
  private:
+    // 每个写线程缓存的统计块数量（同一线程写多个 RingBuffer 时按实例缓存）
+    static constexpr size_t kWriterStatsCacheSize = 4;
+
+    // 写线程独占的统计块：只有所属线程写入（无需原子读改写），读取统计时再汇总
+    struct alignas(64) WriterStats {
+        std::atomic<size_t> writes{0};
+        std::atomic<size_t> failed_writes{0};
+    };
+
     // 缓存行对齐，避免伪共享
     alignas(64) std::atomic<size_t> head_{0};
-    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) std::atomic<size_t> tail_{0};  // 提交游标（Unity 读取端可见）
+    alignas(64) std::atomic<uint64_t> claim_{0};  // kMulti 预留游标（未取模，避免 ABA）
 
     // 缓冲区数据（固定大小，预分配）
     std::vector<uint8_t> buffer_;
     const size_t capacity_;  // 固定容量，不可改变
     const size_t mask_;      // 用于快速取模运算 (capacity_ - 1)
+    const ProducerMode mode_;
+
+    // kSingle 模式下是否有未结束的预留（仅写线程访问）
+    bool single_reserved_{false};
+
+    // 实例编号（线程本地缓存据此区分实例，不受地址复用影响）
+    const uint64_t instance_id_;
+
+    // 写端统计：每个写线程首次写入时登记自己的统计块
+    mutable std::mutex writer_stats_mutex_;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<WriterStats>>> writer_stats_;
 
-    // 统计信息（简化）
-    mutable std::atomic<size_t> total_writes_{0};
+    // 读端统计（单读线程）
     mutable std::atomic<size_t> total_reads_{0};
-    mutable std::atomic<size_t> failed_writes_{0};
     mutable std::atomic<size_t> failed_reads_{0};
 
+    /**
+     * 预留区间（不检查 kSkipHeaderSize 下限）：Write 拷贝后必定 Commit，
+     * 不会走 Abort，因此 kMulti 模式下也可写入小于消息头的数据
+     */
+    Error ReserveRange(size_t size, WriteReservation* reservation);
+
+    /**
+     * 单写线程预留：直接基于 tail_ 计算
+     */
+    bool ClaimSingle(size_t size, size_t* start);
+
+    /**
+     * 多写线程预留：CAS 推进 claim_
+     */
+    bool ClaimMulti(size_t size, size_t* start);
+
+    /**
+     * 拷贝数据到缓冲区指定位置（处理环绕）
+     */
+    void CopyIn(size_t pos, const uint8_t* data, size_t size);
+
+    /**
+     * 把 [pos, pos + size) 填充为连续的跳过记录（处理环绕）
+     */
+    void FillSkipRecords(size_t pos, size_t size);
+
+    /**
+     * 等待前序预留提交完成后推进提交游标
+     * @param start 本次预留的起始位置
+     * @param size 本次预留的大小
+     */
+    void CommitInOrder(size_t start, size_t size);
+
+    /**
+     * 计算可写空间
+     */
+    size_t AvailableSpace(size_t head, size_t tail) const;
+
+    /**
+     * 获取当前线程的统计块（首次写入时登记）
+     */
+    WriterStats& LocalWriterStats();
+
+    /**
+     * 累加线程独占的计数器（只有所属线程写入）
+     */
+    static void AddOwned(std::atomic<size_t>& counter, size_t value);
+
     /**
      * 检查容量是否为2的幂次
      * @param capacity 要检查的容量
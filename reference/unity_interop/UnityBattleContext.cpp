@@ -17,9 +17,14 @@
 #include "MessageFactory.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <span>
 
+static_assert(UnityBattleContext::kMessageHeaderSize == BattleMessageHandler::kMessageHeaderSize,
+              "UnityBattleContext message header size must match BattleMessageHandler");
+
 UnityBattleContext::UnityBattleContext() = default;
 
 UnityBattleContext::~UnityBattleContext() {
@@ -48,8 +53,11 @@ bool UnityBattleContext::Initialize(const char* battle_enter_info_str,
         EnvManager::getInstance().setIsServer(is_server);
 
         // 初始化环形缓冲区
+        // 输入缓冲区只有 Unity 一个写端；输出缓冲区可能由多个模拟线程并发写入
         input_buffer_ = std::make_unique<RingBuffer>();
-        output_buffer_ = std::make_unique<RingBuffer>();
+        output_buffer_ = std::make_unique<RingBuffer>(RingBuffer::kDefaultCapacity,
+                                                      RingBuffer::ProducerMode::kMulti);
+        snapshot_buffer_ = std::make_unique<FrameSnapshotBuffer>();
 
         auto enter_info = BattleUtils::createBattleEnterInfo(battle_enter_info_proto);
         if (!enter_info) {
@@ -98,6 +106,9 @@ void UnityBattleContext::Cleanup() {
     if (output_buffer_) {
         output_buffer_.reset();
     }
+    if (snapshot_buffer_) {
+        snapshot_buffer_.reset();
+    }
 
     initialized_ = false;
     LOG_INFO("UnityBattleContext", "Battle context cleaned up");
@@ -151,65 +162,100 @@ void UnityBattleContext::ProcessIncomingMessages() {
         return;
     }
 
-    // 从输入缓冲区读取所有数据
-    std::string data = input_buffer_->ReadAll();
-    if (data.empty()) {
+    // 直接在环形缓冲区内解析，不拷贝到 std::string
+    RingBuffer::ReadRegion region = input_buffer_->PeekRead();
+    if (region.empty()) {
         return;  // 没有新数据
     }
 
-    // 处理接收到的数据
-    size_t offset = 0;
-    const size_t dataSize = data.size();
+    // 逐条解析消息（消息头：2字节大小 + 2字节ID）
+    auto scan = ScanMessages(
+        region,
+        SIZE_MAX,
+        [this, &region](size_t offset, uint16_t messageSize, uint16_t messageId) {
+            // 消息体视图（只有跨越环绕点时才拷贝到复用的临时缓冲区）
+            auto messageBodySpan = ContiguousView(region, offset + kMessageHeaderSize, messageSize);
+
+            // 解析并处理消息
+            if (!parseAndDispatchMessage(messageId, messageBodySpan)) {
+                LOG_WARN("UnityBattleContext",
+                         "Failed to parse message with ID: {} at offset {}",
+                         messageId,
+                         offset);
+            }
+        });
+
+    if (scan.malformed) {
+        // 帧格式已损坏，丢弃剩余数据
+        LOG_ERROR("UnityBattleContext", "Invalid message header at offset {}", scan.consumed);
+        input_buffer_->ConsumeRead(region.size());
+        return;
+    }
 
-    while (offset < dataSize) {
-        // 检查是否有足够的数据读取消息头（4字节：2字节大小 + 2字节ID）
-        if (offset + BattleMessageHandler::kMessageHeaderSize > dataSize) {
-            LOG_WARN("UnityBattleContext", "Incomplete message header at offset {}", offset);
-            break;
-        }
+    if (scan.consumed < region.size()) {
+        LOG_WARN("UnityBattleContext", "Incomplete message at offset {}", scan.consumed);
+    }
 
-        // 读取消息大小和ID
-        auto dataSpan =
-            std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(data.data()), data.size());
-        auto headerSpan = dataSpan.subspan(offset, BattleMessageHandler::kMessageHeaderSize);
-        uint16_t messageSize = *reinterpret_cast<const uint16_t*>(headerSpan.data());
-        uint16_t messageId =
-            *reinterpret_cast<const uint16_t*>(headerSpan.subspan(sizeof(uint16_t)).data());
-
-        // 检查消息大小是否合理
-        if (messageSize == 0 || messageSize > 65535) {
-            LOG_ERROR(
-                "UnityBattleContext", "Invalid message size: {} at offset {}", messageSize, offset);
-            break;
-        }
+    // 释放已处理的数据，不完整的消息留到下一帧
+    input_buffer_->ConsumeRead(scan.consumed);
+}
 
-        // 检查是否有足够的数据读取完整消息
-        size_t totalMessageSize = BattleMessageHandler::kMessageHeaderSize + messageSize;
-        if (offset + totalMessageSize > dataSize) {
-            LOG_WARN("UnityBattleContext", "Incomplete message body at offset {}", offset);
-            break;
-        }
+RingBuffer::Error UnityBattleContext::CommitInputBatch(size_t new_tail, size_t message_count) {
+    if (!input_buffer_ || message_count == 0) {
+        return RingBuffer::Error::kInvalidArgument;
+    }
 
-        // 提取消息体
-        auto messageBodySpan =
-            dataSpan.subspan(offset + BattleMessageHandler::kMessageHeaderSize, messageSize);
-        std::string messageBody(reinterpret_cast<const char*>(messageBodySpan.data()), messageSize);
-
-        // 解析并处理消息
-        if (!parseAndDispatchMessage(messageId, messageBody)) {
-            LOG_WARN("UnityBattleContext",
-                     "Failed to parse message with ID: {} at offset {}",
-                     messageId,
-                     offset);
-        }
+    size_t head = 0;
+    size_t tail = 0;
+    auto result = input_buffer_->PrepareWrite(&head, &tail);
+    if (result != RingBuffer::Error::kSuccess) {
+        return result;
+    }
+
+    // 新写入的数据不能超过提交前的可写空间
+    const size_t mask = input_buffer_->GetCapacity() - 1;
+    const size_t written = (new_tail - tail) & mask;
+    const size_t available = input_buffer_->GetCapacity() - ((tail - head) & mask) - 1;
+    if (new_tail >= input_buffer_->GetCapacity() || written == 0 || written > available) {
+        return RingBuffer::Error::kInvalidArgument;
+    }
+
+    // 校验帧格式：新区域必须恰好由 message_count 条完整消息组成
+    auto region = input_buffer_->GetRegion(tail, new_tail);
+    auto scan = ScanMessages(region, message_count, [](size_t, uint16_t, uint16_t) {});
+    if (scan.malformed || scan.message_count != message_count || scan.consumed != written) {
+        LOG_WARN("UnityBattleContext",
+                 "Batch commit rejected: expected {} messages in {} bytes, found {} in {} bytes",
+                 message_count,
+                 written,
+                 scan.message_count,
+                 scan.consumed);
+        return RingBuffer::Error::kInvalidArgument;
+    }
+
+    return input_buffer_->CommitWrite(new_tail, message_count);
+}
 
-        // 移动到下一个消息
-        offset += totalMessageSize;
+std::span<const uint8_t> UnityBattleContext::ContiguousView(
+    const RingBuffer::ReadRegion& region, size_t offset, size_t size) {
+    const size_t firstSize = region.first.size();
+    if (offset + size <= firstSize) {
+        return region.first.subspan(offset, size);
     }
+    if (offset >= firstSize) {
+        return region.second.subspan(offset - firstSize, size);
+    }
+
+    // 跨越环绕点：拼接到临时缓冲区（容量只增不减，避免逐消息分配）
+    const size_t headPart = firstSize - offset;
+    scratch_.resize(size);
+    std::memcpy(scratch_.data(), region.first.subspan(offset).data(), headPart);
+    std::memcpy(scratch_.data() + headPart, region.second.data(), size - headPart);
+    return std::span<const uint8_t>(scratch_.data(), size);
 }
 
 bool UnityBattleContext::parseAndDispatchMessage(uint16_t messageId,
-                                                 const std::string& messageBody) {
+                                                 std::span<const uint8_t> messageBody) {
     if (!battle_) {
         LOG_ERROR("UnityBattleContext", "Battle instance not initialized");
         return false;
@@ -223,7 +269,7 @@ bool UnityBattleContext::parseAndDispatchMessage(uint16_t messageId,
     }
 
     // 反序列化消息体
-    if (!message->ParseFromString(messageBody)) {
+    if (!message->ParseFromArray(messageBody.data(), static_cast<int>(messageBody.size()))) {
         LOG_ERROR("UnityBattleContext", "Failed to parse message body for ID: {}", messageId);
         return false;
     }
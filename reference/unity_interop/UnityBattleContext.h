@@ -1,9 +1,14 @@
 #pragma once
 
+#include "FrameSnapshotBuffer.h"
 #include "RingBuffer.h"
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 // 前向声明
 class Battle;
@@ -14,6 +19,18 @@ class Battle;
  */
 class UnityBattleContext {
  public:
+    // 消息头大小（2字节消息体大小 + 2字节消息ID），与 BattleMessageHandler::kMessageHeaderSize 一致
+    static constexpr size_t kMessageHeaderSize = sizeof(uint16_t) * 2;
+    static_assert(kMessageHeaderSize == RingBuffer::kSkipHeaderSize,
+                  "RingBuffer skip records must use the message header layout");
+
+    // 消息帧扫描结果
+    struct FrameScanResult {
+        size_t message_count{0};  // 完整消息数
+        size_t consumed{0};       // 完整消息占用的总字节数（含消息头）
+        bool malformed{false};    // 遇到非法消息头
+    };
+
     UnityBattleContext();
     ~UnityBattleContext();
 
@@ -61,12 +78,37 @@ class UnityBattleContext {
         return output_buffer_.get();
     }
 
+    // 获取帧快照区（模拟侧序列化整帧状态后发布，Unity 读取最新帧）
+    FrameSnapshotBuffer* GetSnapshotBuffer() const {
+        return snapshot_buffer_.get();
+    }
+
+    // 批量提交输入：校验 [tail, new_tail) 恰好包含 message_count 条完整消息后一次性提交
+    RingBuffer::Error CommitInputBatch(size_t new_tail, size_t message_count);
+
+    /**
+     * 逐条扫描区域内的完整消息，不拷贝消息体
+     * @param region 待扫描区域
+     * @param max_messages 最多扫描的消息数
+     * @param visitor 回调 visitor(offset, messageSize, messageId)，offset 为消息头在区域内的偏移
+     * @return 扫描结果，不完整的尾部消息不计入
+     */
+    template <typename Visitor>
+    static FrameScanResult ScanMessages(const RingBuffer::ReadRegion& region,
+                                        size_t max_messages,
+                                        Visitor&& visitor);
+
  private:
     // 处理输入消息
     void ProcessIncomingMessages();
 
     // 解析并分发单个消息
-    bool parseAndDispatchMessage(uint16_t messageId, const std::string& messageBody);
+    bool parseAndDispatchMessage(uint16_t messageId, std::span<const uint8_t> messageBody);
+
+    // 获取可读区域中 [offset, offset + size) 的连续视图，跨越环绕点时拷贝到 scratch_
+    std::span<const uint8_t> ContiguousView(const RingBuffer::ReadRegion& region,
+                                            size_t offset,
+                                            size_t size);
 
     // 内部成员
     std::unique_ptr<Battle> battle_;
@@ -75,9 +117,59 @@ class UnityBattleContext {
     std::unique_ptr<RingBuffer> input_buffer_;   // Unity → C++
     std::unique_ptr<RingBuffer> output_buffer_;  // C++ → Unity
 
+    // 帧快照区（C++ → Unity，只保留最新的完整帧）
+    std::unique_ptr<FrameSnapshotBuffer> snapshot_buffer_;
+
+    // 跨越环绕点的消息拼接缓冲区（复用，避免逐消息分配）
+    std::vector<uint8_t> scratch_;
+
     // 状态标识
     bool initialized_{false};
 
     // 常量配置
     static constexpr size_t kDefaultBufferSize = RingBuffer::kDefaultCapacity;
-};
\ No newline at end of file
+};
+
+template <typename Visitor>
+UnityBattleContext::FrameScanResult UnityBattleContext::ScanMessages(
+    const RingBuffer::ReadRegion& region, size_t max_messages, Visitor&& visitor) {
+    FrameScanResult result;
+    const size_t dataSize = region.size();
+    const size_t firstSize = region.first.size();
+
+    while (result.message_count < max_messages &&
+           result.consumed + kMessageHeaderSize <= dataSize) {
+        // 读取消息头（可能跨越环绕点，逐字节拼接）
+        uint8_t header[kMessageHeaderSize];
+        for (size_t i = 0; i < kMessageHeaderSize; ++i) {
+            size_t pos = result.consumed + i;
+            header[i] = pos < firstSize ? region.first[pos] : region.second[pos - firstSize];
+        }
+        uint16_t messageSize = 0;
+        uint16_t messageId = 0;
+        std::memcpy(&messageSize, header, sizeof(uint16_t));
+        std::memcpy(&messageId, header + sizeof(uint16_t), sizeof(uint16_t));
+
+        const bool skip = messageId == RingBuffer::kSkipMessageId;
+        if (messageSize == 0 && !skip) {
+            result.malformed = true;
+            break;
+        }
+
+        size_t totalMessageSize = kMessageHeaderSize + messageSize;
+        if (result.consumed + totalMessageSize > dataSize) {
+            break;  // 不完整的消息
+        }
+        if (skip) {
+            // 写线程放弃的预留（RingBuffer::Abort），不计入消息数
+            result.consumed += totalMessageSize;
+            continue;
+        }
+
+        visitor(result.consumed, messageSize, messageId);
+        result.consumed += totalMessageSize;
+        ++result.message_count;
+    }
+
+    return result;
+}
@@ -11,6 +11,9 @@
 #include "Logger.h"
 #include "Version.h"
 
+static_assert(HGAME_BATTLE_SKIP_MESSAGE_ID == RingBuffer::kSkipMessageId,
+              "C ABI skip message ID must match RingBuffer");
+
 namespace {
 std::string g_lastError;
 int g_lastErrorCode = HGAME_BATTLE_SUCCESS;
@@ -542,4 +545,121 @@ extern "C" HGameBattleResult HGameBattle_CommitOutputRead(HGameBattleContext* co
 
     return HGAME_BATTLE_SUCCESS;
 }
-}
\ No newline at end of file
+
+// ===== 高性能批量通信API实现 =====
+
+extern "C" HGameBattleResult HGameBattle_CommitInputWriteBatch(HGameBattleContext* context,
+                                                               size_t newTail,
+                                                               int messageCount) {
+    if (!context || messageCount <= 0) {
+        return HGAME_BATTLE_ERROR_INVALID_PARAM;
+    }
+
+    auto* battleContext = static_cast<UnityBattleContext*>(context->handle);
+    if (!battleContext) {
+        return HGAME_BATTLE_ERROR_NOT_INITIALIZED;
+    }
+
+    // 校验帧格式并一次性提交（统计按消息数计入）
+    auto result = battleContext->CommitInputBatch(newTail, static_cast<size_t>(messageCount));
+    if (result != RingBuffer::Error::kSuccess) {
+        return HGAME_BATTLE_ERROR_INVALID_PARAM;
+    }
+
+    return HGAME_BATTLE_SUCCESS;
+}
+
+extern "C" HGameBattleResult HGameBattle_DrainOutputMessages(HGameBattleContext* context,
+                                                             size_t releaseHead,
+                                                             HGameBattleMessageDesc* descs,
+                                                             int maxCount,
+                                                             int* count,
+                                                             size_t* nextHead) {
+    if (!context || !descs || maxCount <= 0 || !count || !nextHead) {
+        return HGAME_BATTLE_ERROR_INVALID_PARAM;
+    }
+
+    auto* battleContext = static_cast<UnityBattleContext*>(context->handle);
+    if (!battleContext) {
+        return HGAME_BATTLE_ERROR_NOT_INITIALIZED;
+    }
+
+    // 获取输出缓冲区的RingBuffer
+    auto* ringBuffer = battleContext->GetOutputBuffer();
+    if (!ringBuffer) {
+        return HGAME_BATTLE_ERROR_INVALID_PARAM;
+    }
+
+    // 释放上一帧已处理的数据
+    if (releaseHead != HGAME_BATTLE_KEEP_HEAD &&
+        ringBuffer->CommitRead(releaseHead) != RingBuffer::Error::kSuccess) {
+        return HGAME_BATTLE_ERROR_INVALID_PARAM;
+    }
+
+    // 扫描当前所有完整消息，填充描述符
+    const size_t head = ringBuffer->GetHead();
+    const size_t mask = ringBuffer->GetCapacity() - 1;
+    auto region = ringBuffer->PeekRead();
+    size_t index = 0;
+    auto scan = UnityBattleContext::ScanMessages(
+        region,
+        static_cast<size_t>(maxCount),
+        [descs, head, mask, &index](size_t offset, uint16_t messageSize, uint16_t messageId) {
+            auto& desc = descs[index++];
+            desc.bodyOffset = (head + offset + UnityBattleContext::kMessageHeaderSize) & mask;
+            desc.bodySize = messageSize;
+            desc.messageId = messageId;
+            desc.reserved = 0;
+        });
+
+    *count = static_cast<int>(scan.message_count);
+    *nextHead = (head + scan.consumed) & mask;
+
+    if (scan.malformed) {
+        // 帧格式已损坏，之后的数据无法定位消息边界：nextHead 越过剩余数据，
+        // 下一次调用释放后输出恢复正常，已扫描到的完整消息仍然有效
+        *nextHead = (head + region.size()) & mask;
+        SetLastError("Malformed message header in output buffer", HGAME_BATTLE_ERROR_UPDATE_FAILED);
+        return HGAME_BATTLE_ERROR_UPDATE_FAILED;
+    }
+
+    return HGAME_BATTLE_SUCCESS;
+}
+
+extern "C" HGameBattleResult HGameBattle_AcquireFrameSnapshot(HGameBattleContext* context,
+                                                              const void** data,
+                                                              size_t* size,
+                                                              uint64_t* frameId,
+                                                              int* updated) {
+    if (!context || !data || !size || !frameId || !updated) {
+        return HGAME_BATTLE_ERROR_INVALID_PARAM;
+    }
+
+    auto* battleContext = static_cast<UnityBattleContext*>(context->handle);
+    if (!battleContext) {
+        return HGAME_BATTLE_ERROR_NOT_INITIALIZED;
+    }
+
+    auto* snapshotBuffer = battleContext->GetSnapshotBuffer();
+    if (!snapshotBuffer) {
+        return HGAME_BATTLE_ERROR_NOT_INITIALIZED;
+    }
+
+    FrameSnapshotBuffer::Snapshot snapshot;
+    if (!snapshotBuffer->AcquireLatest(&snapshot)) {
+        // 尚未发布任何帧
+        *data = nullptr;
+        *size = 0;
+        *frameId = 0;
+        *updated = 0;
+        return HGAME_BATTLE_SUCCESS;
+    }
+
+    *data = snapshot.data.data();
+    *size = snapshot.data.size();
+    *frameId = snapshot.frame_id;
+    *updated = snapshot.updated ? 1 : 0;
+
+    return HGAME_BATTLE_SUCCESS;
+}
+}
@@ -49,6 +49,21 @@ typedef struct {
     uint64_t outputCurrentSize;
 } HGameBattleBufferStats;
 
+// 批量读取输出消息时的消息描述符（偏移已取模，消息体可能跨越环绕点，需按 capacity 回绕）
+typedef struct {
+    size_t bodyOffset;   // 消息体在缓冲区中的起始偏移
+    uint32_t bodySize;   // 消息体大小（不含消息头）
+    uint16_t messageId;  // 消息ID
+    uint16_t reserved;
+} HGameBattleMessageDesc;
+
+// HGameBattle_DrainOutputMessages 的 releaseHead 取此值时不释放任何数据
+#define HGAME_BATTLE_KEEP_HEAD ((size_t)-1)
+
+// 输出缓冲区中的跳过记录（写线程放弃的预留）使用此消息ID，直接读取缓冲区时按消息头大小整条跳过；
+// HGameBattle_DrainOutputMessages 已自动跳过，不会返回此类描述符
+#define HGAME_BATTLE_SKIP_MESSAGE_ID 0xFFFF
+
 // ===== 零拷贝API =====
 
 // 初始化战斗逻辑系统
@@ -94,6 +109,34 @@ HGameBattle_CheckStatus(HGameBattleContext* context);
 
 // ===== 高性能批量通信API =====
 
+// 批量提交写入：Unity 已在 [tail, newTail) 写入 messageCount 条带消息头的完整消息，一次性提交
+// 帧格式校验失败时不提交，返回 HGAME_BATTLE_ERROR_INVALID_PARAM
+HGAME_BATTLE_API HGameBattleResult HGAME_BATTLE_CALL
+HGameBattle_CommitInputWriteBatch(HGameBattleContext* context, size_t newTail, int messageCount);
+
+// 批量读取输出：先释放到 releaseHead（HGAME_BATTLE_KEEP_HEAD 表示不释放），
+// 再填充当前所有完整消息的描述符（最多 maxCount 条），nextHead 为这些消息之后的位置，
+// 处理完成后作为下一次调用的 releaseHead 传入，整帧输出只需一次 P/Invoke
+// releaseHead 不在当前头尾位置之间时不释放，返回 HGAME_BATTLE_ERROR_INVALID_PARAM；
+// 遇到非法消息头时返回 HGAME_BATTLE_ERROR_UPDATE_FAILED，count 条描述符仍然有效，
+// nextHead 越过损坏的剩余数据，照常作为下一次的 releaseHead 传入即可恢复
+HGAME_BATTLE_API HGameBattleResult HGAME_BATTLE_CALL
+HGameBattle_DrainOutputMessages(HGameBattleContext* context,
+                                size_t releaseHead,
+                                HGameBattleMessageDesc* descs,
+                                int maxCount,
+                                int* count,
+                                size_t* nextHead);
+
+// 获取最新的完整帧快照（三缓冲，只需读取最新状态时代替逐条解析输出消息）
+// data 在下一次调用前有效；尚未发布任何帧时 size 为 0；updated 表示自上次调用以来是否有新帧
+HGAME_BATTLE_API HGameBattleResult HGAME_BATTLE_CALL
+HGameBattle_AcquireFrameSnapshot(HGameBattleContext* context,
+                                 const void** data,
+                                 size_t* size,
+                                 uint64_t* frameId,
+                                 int* updated);
+
 // ===== 内存地址获取API =====
 
 // ===== 直接内存写入API =====
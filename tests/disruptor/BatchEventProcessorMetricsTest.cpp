@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BatchEventProcessorMetrics.h"
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/util/Util.h"
+#include "tests/disruptor/support/StubEvent.h"
+#include "tests/disruptor/test_support/CountDownLatch.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+struct TimestampedEvent {
+  int64_t value{0};
+  int64_t publishTimestamp{0};
+
+  int64_t getPublishTimestamp() const { return publishTimestamp; }
+
+  struct Factory final : public disruptor::EventFactory<TimestampedEvent> {
+    TimestampedEvent newInstance() override { return TimestampedEvent{}; }
+  };
+};
+
+class CountingHandler final : public disruptor::EventHandler<TimestampedEvent> {
+public:
+  explicit CountingHandler(disruptor::test_support::CountDownLatch& latch) : latch_(&latch) {}
+
+  void onEvent(TimestampedEvent& /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    latch_->countDown();
+  }
+
+private:
+  disruptor::test_support::CountDownLatch* latch_;
+};
+
+class StubCountingHandler final : public disruptor::EventHandler<disruptor::support::StubEvent> {
+public:
+  explicit StubCountingHandler(disruptor::test_support::CountDownLatch& latch) : latch_(&latch) {}
+
+  void onEvent(disruptor::support::StubEvent& /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    latch_->countDown();
+  }
+
+private:
+  disruptor::test_support::CountDownLatch* latch_;
+};
+} // namespace
+
+TEST(BatchEventProcessorMetricsTest, shouldNotAddStateWhenMetricsAreDisabled) {
+  EXPECT_TRUE(std::is_empty_v<disruptor::NoOpBatchEventProcessorMetrics>);
+  EXPECT_FALSE(disruptor::NoOpBatchEventProcessorMetrics::kEnabled);
+}
+
+TEST(BatchEventProcessorMetricsTest, shouldRecordBatchSizesWaitsAndPublishToConsumeLatency) {
+  using WS = disruptor::BlockingWaitStrategy;
+  using RB = disruptor::SingleProducerRingBuffer<TimestampedEvent, WS>;
+  constexpr int PUBLISH_COUNT = 8;
+
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(std::make_shared<TimestampedEvent::Factory>(), 16, ws);
+  auto sequenceBarrier = ringBuffer->newBarrier(nullptr, 0);
+
+  disruptor::test_support::CountDownLatch latch(PUBLISH_COUNT);
+  CountingHandler handler(latch);
+
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build<disruptor::BatchEventProcessorMetrics>(*ringBuffer, *sequenceBarrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  // Publish the whole batch before the consumer starts so it is seen as one batch.
+  const int64_t hi = ringBuffer->next(PUBLISH_COUNT);
+  for (int64_t seq = hi - PUBLISH_COUNT + 1; seq <= hi; ++seq) {
+    auto& event = ringBuffer->get(seq);
+    event.value = seq;
+    event.publishTimestamp = disruptor::util::Util::nanoTime();
+  }
+  ringBuffer->publish(hi - PUBLISH_COUNT + 1, hi);
+
+  std::thread t([&] { processor->run(); });
+  latch.await();
+  processor->halt();
+  t.join();
+
+  const auto& metrics = processor->getMetrics();
+  EXPECT_EQ(1, metrics.getBatchSizes().getTotalCount());
+  EXPECT_EQ(PUBLISH_COUNT, metrics.getBatchSizes().getMax());
+  EXPECT_EQ(1, metrics.getWaitDurations().getTotalCount());
+  EXPECT_EQ(PUBLISH_COUNT, metrics.getPublishToConsumeLatencies().getTotalCount());
+  EXPECT_GE(metrics.getPublishToConsumeLatencies().getMin(), 0);
+}
+
+TEST(BatchEventProcessorMetricsTest, shouldSkipLatencyForEventsWithoutTimestamp) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BlockingWaitStrategy;
+  using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::EVENT_FACTORY, 16, ws);
+  auto sequenceBarrier = ringBuffer->newBarrier(nullptr, 0);
+
+  disruptor::test_support::CountDownLatch latch(3);
+  StubCountingHandler handler(latch);
+
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build<disruptor::BatchEventProcessorMetrics>(*ringBuffer, *sequenceBarrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  std::thread t([&] { processor->run(); });
+  for (int i = 0; i < 3; ++i) {
+    ringBuffer->publish(ringBuffer->next());
+  }
+  latch.await();
+  processor->halt();
+  t.join();
+
+  const auto& metrics = processor->getMetrics();
+  EXPECT_GE(metrics.getBatchSizes().getTotalCount(), 1);
+  EXPECT_EQ(0, metrics.getPublishToConsumeLatencies().getTotalCount());
+}
+
+TEST(BatchEventProcessorMetricsTest, shouldTimeWholeWaitWhenWaitForReturnsShort) {
+  using WS = disruptor::BlockingWaitStrategy;
+  using RB = disruptor::MultiProducerRingBuffer<TimestampedEvent, WS>;
+  constexpr int64_t GAP_NANOS = 20'000'000;
+
+  WS ws;
+  auto ringBuffer = RB::createMultiProducer(std::make_shared<TimestampedEvent::Factory>(), 16, ws);
+  auto sequenceBarrier = ringBuffer->newBarrier(nullptr, 0);
+
+  disruptor::test_support::CountDownLatch latch(2);
+  CountingHandler handler(latch);
+
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build<disruptor::BatchEventProcessorMetrics>(*ringBuffer, *sequenceBarrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  // Sequence 1 is published ahead of 0, so waitFor(0) keeps returning short
+  // until 0 is published.
+  const int64_t hi = ringBuffer->next(2);
+  ringBuffer->publish(hi);
+  std::thread t([&] { processor->run(); });
+  std::this_thread::sleep_for(std::chrono::nanoseconds(GAP_NANOS));
+  ringBuffer->publish(hi - 1);
+
+  latch.await();
+  processor->halt();
+  t.join();
+
+  const auto& metrics = processor->getMetrics();
+  EXPECT_EQ(1, metrics.getWaitDurations().getTotalCount());
+  EXPECT_GE(metrics.getWaitDurations().getMax(), GAP_NANOS / 2);
+}
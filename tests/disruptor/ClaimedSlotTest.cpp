@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/ClaimedSlot.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+using disruptor::support::LongEvent;
+using WS = disruptor::BusySpinWaitStrategy;
+using RingBufferT = disruptor::SingleProducerRingBuffer<LongEvent, WS>;
+} // namespace
+
+TEST(ClaimedSlotTest, shouldPublishSlotWhenLeavingScope) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 8, ws);
+  {
+    auto slot = ringBuffer->claim();
+    slot->set(42);
+    EXPECT_EQ(0, slot.getSequence());
+    EXPECT_EQ(disruptor::Sequencer::INITIAL_CURSOR_VALUE, ringBuffer->getCursor());
+  }
+  EXPECT_EQ(0, ringBuffer->getCursor());
+  EXPECT_EQ(42, ringBuffer->get(0).get());
+}
+
+TEST(ClaimedSlotTest, shouldPublishSlotWhenScopeExitsByException) {
+  WS ws;
+  auto ringBuffer = disruptor::MultiProducerRingBuffer<LongEvent, WS>::createMultiProducer(LongEvent::FACTORY, 8, ws);
+  try {
+    auto slot = ringBuffer->claim();
+    slot->set(1);
+    throw std::runtime_error("failed while writing");
+  } catch (const std::runtime_error &) {
+  }
+
+  // The multi-producer sequencer tracks availability per slot, so a missing
+  // publish would show up here as -1.
+  EXPECT_EQ(0, ringBuffer->getSequencer().getHighestPublishedSequence(0, 0));
+}
+
+TEST(ClaimedSlotTest, shouldPublishOnceAfterMoveOrExplicitPublish) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 8, ws);
+  auto first = ringBuffer->claim();
+  auto moved = std::move(first);
+  EXPECT_FALSE(first.isPending());
+  EXPECT_TRUE(moved.isPending());
+
+  moved.publish();
+  EXPECT_FALSE(moved.isPending());
+  EXPECT_EQ(0, ringBuffer->getCursor());
+
+  auto second = ringBuffer->claim();
+  moved = std::move(second);
+  EXPECT_EQ(1, moved.getSequence());
+}
+
+TEST(ClaimedSlotTest, shouldExposeWrappedRangeAsTwoSpans) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 8, ws);
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+  ringBuffer->publish(ringBuffer->next(6));
+  gating.set(5);
+
+  {
+    auto range = ringBuffer->claim(5);
+    EXPECT_EQ(5, range.size());
+    EXPECT_EQ(6, range.getLowSequence());
+    EXPECT_EQ(10, range.getHighSequence());
+
+    auto [head, tail] = range.spans();
+    ASSERT_EQ(2u, head.size());
+    ASSERT_EQ(3u, tail.size());
+    int64_t value = 6;
+    for (auto &event : head) {
+      event.set(value++);
+    }
+    for (auto &event : tail) {
+      event.set(value++);
+    }
+    EXPECT_EQ(&range[2], &tail[0]);
+  }
+
+  EXPECT_EQ(10, ringBuffer->getCursor());
+  for (int64_t sequence = 6; sequence <= 10; ++sequence) {
+    EXPECT_EQ(sequence, ringBuffer->get(sequence).get());
+  }
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/ConflatingQueue.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/SingleProducerSequencer.h"
+
+#include "tests/disruptor/test_support/Await.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+using disruptor::test_support::awaitSequence;
+using WS = disruptor::BusySpinWaitStrategy;
+using EntryT = disruptor::ConflatedEntry<int64_t, int64_t>;
+using SingleProducerQueue = disruptor::ConflatingQueue<int64_t, int64_t, disruptor::SingleProducerSequencer<WS>>;
+using MultiProducerQueue = disruptor::ConflatingQueue<int64_t, int64_t, disruptor::MultiProducerSequencer<WS>>;
+
+class RecordingHandler final : public disruptor::EventHandler<EntryT> {
+public:
+  void onEvent(EntryT &entry, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    updates_.emplace_back(entry.key, entry.value);
+  }
+
+  std::vector<std::pair<int64_t, int64_t>> updates() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return updates_;
+  }
+
+private:
+  std::mutex mutex_;
+  std::vector<std::pair<int64_t, int64_t>> updates_;
+};
+} // namespace
+
+TEST(ConflatingQueueTest, shouldDeliverOnlyLatestValuePerKey) {
+  WS ws;
+  SingleProducerQueue queue(16, ws);
+  auto barrier = queue.getRingBuffer().newBarrier();
+  RecordingHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build(queue, *barrier, handler);
+  queue.getRingBuffer().addGatingSequences(processor->getSequence());
+
+  for (int64_t i = 0; i < 50; ++i) {
+    queue.update(1, i);
+  }
+  queue.update(2, 200);
+  queue.update(1, 100);
+  EXPECT_EQ(1, queue.getRingBuffer().getCursor());
+  EXPECT_EQ(50, queue.getConflatedCount());
+
+  std::thread thread([&] { processor->run(); });
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), 1));
+  processor->halt();
+  thread.join();
+
+  const std::vector<std::pair<int64_t, int64_t>> expected{{1, 100}, {2, 200}};
+  EXPECT_EQ(expected, handler.updates());
+}
+
+TEST(ConflatingQueueTest, shouldRequeueKeyUpdatedAfterConsumerReadIt) {
+  WS ws;
+  SingleProducerQueue queue(8, ws);
+  auto barrier = queue.getRingBuffer().newBarrier();
+  RecordingHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build(queue, *barrier, handler);
+  queue.getRingBuffer().addGatingSequences(processor->getSequence());
+  std::thread thread([&] { processor->run(); });
+
+  queue.update(7, 1);
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), 0));
+  queue.update(7, [](int64_t &latest) { latest += 10; });
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), 1));
+  processor->halt();
+  thread.join();
+
+  const std::vector<std::pair<int64_t, int64_t>> expected{{7, 1}, {7, 11}};
+  EXPECT_EQ(expected, handler.updates());
+  EXPECT_EQ(0, queue.getConflatedCount());
+}
+
+TEST(ConflatingQueueTest, shouldConvergeOnFinalValuesWithConcurrentProducers) {
+  WS ws;
+  MultiProducerQueue queue(64, ws);
+  auto barrier = queue.getRingBuffer().newBarrier();
+  RecordingHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build(queue, *barrier, handler);
+  queue.getRingBuffer().addGatingSequences(processor->getSequence());
+  std::thread consumer([&] { processor->run(); });
+
+  // Each producer owns 8 keys (other producers' keys collide in the table).
+  constexpr int kProducers = 4;
+  constexpr int64_t kUpdates = 2000;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&queue, p] {
+      for (int64_t value = 1; value <= kUpdates; ++value) {
+        for (int64_t key = p * 8; key < p * 8 + 8; ++key) {
+          queue.update(key, value);
+        }
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), queue.getRingBuffer().getCursor()));
+  processor->halt();
+  consumer.join();
+
+  const std::vector<std::pair<int64_t, int64_t>> updates = handler.updates();
+  std::map<int64_t, int64_t> latest;
+  for (const auto &[key, value] : updates) {
+    EXPECT_LE(latest[key], value) << "key " << key;
+    latest[key] = value;
+  }
+  ASSERT_EQ(static_cast<size_t>(kProducers * 8), latest.size());
+  for (const auto &[key, value] : latest) {
+    EXPECT_EQ(kUpdates, value) << "key " << key;
+  }
+  EXPECT_EQ(kProducers * 8 * kUpdates, static_cast<int64_t>(updates.size()) + queue.getConflatedCount());
+}
+
+TEST(ConflatingQueueTest, shouldRejectBadCapacityAndTooManyKeys) {
+  WS ws;
+  EXPECT_THROW(SingleProducerQueue(12, ws), std::invalid_argument);
+
+  SingleProducerQueue queue(4, ws);
+  for (int64_t key = 0; key < 4; ++key) {
+    queue.update(key * 1000, key);
+  }
+  queue.update(0, 1);
+  EXPECT_THROW(queue.update(4000, 4), std::runtime_error);
+}
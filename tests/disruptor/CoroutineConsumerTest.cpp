@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/AsyncSequenceBarrier.h"
+#include "disruptor/CoroutineExecutor.h"
+#include "disruptor/EpochWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using WS = disruptor::EpochWaitStrategy;
+using RingBufferT = disruptor::SingleProducerRingBuffer<LongEvent, WS>;
+using AsyncBarrierT = disruptor::AsyncSequenceBarrier<RingBufferT>;
+
+disruptor::ConsumerTask sumValues(AsyncBarrierT &barrier, disruptor::Sequence &sequence,
+                                  std::atomic<int64_t> &sum) {
+  int64_t next = sequence.get() + 1;
+  while (true) {
+    const int64_t available = co_await barrier.nextBatch(next);
+    int64_t batchSum = 0;
+    for (; next <= available; ++next) {
+      batchSum += barrier.get(next).get();
+    }
+    sequence.set(available);
+    sum.fetch_add(batchSum, std::memory_order_release);
+  }
+}
+
+disruptor::ConsumerTask failOnFirstEvent(AsyncBarrierT &barrier) {
+  co_await barrier.nextBatch(0);
+  throw std::runtime_error("consumer failed");
+}
+
+void publish(RingBufferT &ringBuffer, int64_t value) {
+  const int64_t sequence = ringBuffer.next();
+  ringBuffer.get(sequence).set(value);
+  ringBuffer.publish(sequence);
+}
+
+void awaitValue(const std::atomic<int64_t> &value, int64_t expected) {
+  while (value.load(std::memory_order_acquire) != expected) {
+    std::this_thread::yield();
+  }
+}
+} // namespace
+
+TEST(CoroutineConsumerTest, shouldRunManyConsumersOnOneThread) {
+  WS waitStrategy;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 64, waitStrategy);
+  disruptor::CoroutineExecutor executor(waitStrategy);
+  AsyncBarrierT barrier(executor, *ringBuffer);
+
+  constexpr int kConsumers = 500;
+  std::vector<std::unique_ptr<disruptor::Sequence>> sequences;
+  std::vector<std::atomic<int64_t>> sums(kConsumers);
+  for (int i = 0; i < kConsumers; ++i) {
+    sequences.push_back(std::make_unique<disruptor::Sequence>());
+    ringBuffer->addGatingSequences(*sequences.back());
+    executor.spawn(sumValues(barrier, *sequences.back(), sums[static_cast<size_t>(i)]));
+  }
+  EXPECT_EQ(kConsumers, executor.getTaskCount());
+
+  std::thread thread([&] { executor.run(); });
+
+  // More events than the ring size, so every consumer sequence must gate.
+  constexpr int64_t kEvents = 300;
+  for (int64_t n = 1; n <= kEvents; ++n) {
+    publish(*ringBuffer, n);
+  }
+  for (auto &sum : sums) {
+    awaitValue(sum, kEvents * (kEvents + 1) / 2);
+  }
+
+  executor.halt();
+  thread.join();
+}
+
+TEST(CoroutineConsumerTest, shouldResumeSuspendedConsumerOnPublish) {
+  WS waitStrategy;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, waitStrategy);
+  disruptor::CoroutineExecutor executor(waitStrategy, 1);
+  AsyncBarrierT barrier(executor, *ringBuffer);
+  disruptor::Sequence sequence;
+  ringBuffer->addGatingSequences(sequence);
+  std::atomic<int64_t> sum{0};
+  executor.spawn(sumValues(barrier, sequence, sum));
+
+  std::thread thread([&] { executor.run(); });
+
+  // Long enough for the executor to suspend the consumer and park.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  publish(*ringBuffer, 42);
+  awaitValue(sum, 42);
+  EXPECT_EQ(0, sequence.get());
+
+  executor.halt();
+  thread.join();
+}
+
+TEST(CoroutineConsumerTest, shouldFinishConsumerWhenBarrierIsAlerted) {
+  WS waitStrategy;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, waitStrategy);
+  disruptor::CoroutineExecutor executor(waitStrategy);
+  AsyncBarrierT barrier(executor, *ringBuffer);
+  disruptor::Sequence sequence;
+  std::atomic<int64_t> sum{0};
+  executor.spawn(sumValues(barrier, sequence, sum));
+
+  std::thread thread([&] { executor.run(); });
+
+  barrier.alert();
+  while (executor.getTaskCount() != 0) {
+    std::this_thread::yield();
+  }
+
+  executor.halt();
+  thread.join();
+}
+
+TEST(CoroutineConsumerTest, shouldRethrowConsumerExceptionFromRun) {
+  WS waitStrategy;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, waitStrategy);
+  disruptor::CoroutineExecutor executor(waitStrategy);
+  AsyncBarrierT barrier(executor, *ringBuffer);
+  executor.spawn(failOnFirstEvent(barrier));
+  publish(*ringBuffer, 1);
+
+  EXPECT_THROW(executor.run(), std::runtime_error);
+  EXPECT_EQ(0, executor.getTaskCount());
+  EXPECT_FALSE(executor.isRunning());
+}
+
+TEST(CoroutineConsumerTest, shouldRejectRingWithDifferentWaitStrategy) {
+  WS executorWaitStrategy;
+  WS ringWaitStrategy;
+  auto ringBuffer = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, ringWaitStrategy);
+  disruptor::CoroutineExecutor executor(executorWaitStrategy);
+
+  EXPECT_THROW(AsyncBarrierT(executor, *ringBuffer), std::invalid_argument);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/EpochWaitStrategy.h"
+#include "tests/disruptor/support/WaitStrategyTestUtil.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST(EpochWaitStrategyTest, shouldWaitForValue) {
+  disruptor::EpochWaitStrategy waitStrategy;
+  EXPECT_NO_THROW(disruptor::support::WaitStrategyTestUtil::assertWaitForWithDelayOf(50, waitStrategy));
+}
+
+TEST(EpochWaitStrategyTest, shouldWakeParkedWaiterOnSignal) {
+  disruptor::EpochWaitStrategy waitStrategy;
+  std::atomic<bool> woken{false};
+
+  const uint32_t epoch = waitStrategy.prepareToPark();
+  std::thread waiter([&] {
+    waitStrategy.park(epoch);
+    woken.store(true);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(woken.load());
+
+  waitStrategy.signalAllWhenBlocking();
+  waiter.join();
+  EXPECT_TRUE(woken.load());
+}
+
+TEST(EpochWaitStrategyTest, shouldNotParkWhenSignalledAfterPrepare) {
+  disruptor::EpochWaitStrategy waitStrategy;
+
+  const uint32_t epoch = waitStrategy.prepareToPark();
+  waitStrategy.signalAllWhenBlocking();
+
+  // The epoch already moved, so this returns immediately.
+  waitStrategy.park(epoch);
+  SUCCEED();
+}
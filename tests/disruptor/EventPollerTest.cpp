@@ -96,3 +96,41 @@ TEST(EventPollerTest, shouldSuccessfullyPollWhenBufferIsFull) {
   poller->poll(handler);
   EXPECT_EQ(4u, events.size());
 }
+
+TEST(EventPollerTest, shouldLimitEventsPerPollToMaxBatchSize) {
+  using Event = std::array<uint8_t, 1>;
+  using WS = disruptor::SleepingWaitStrategy;
+  using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+
+  WS ws;
+  struct Factory final : public disruptor::EventFactory<Event> {
+    Event newInstance() override { return Event{0}; }
+  };
+  auto ringBuffer = RB::createSingleProducer(std::make_shared<Factory>(), 8, ws);
+
+  using PollerT = disruptor::EventPoller<Event, typename RB::SequencerType>;
+  struct Handler final : public PollerT::Handler {
+    bool onEvent(Event& /*event*/, int64_t sequence, bool endOfBatch) override {
+      sequences.push_back(sequence);
+      endOfBatches.push_back(endOfBatch);
+      return true;
+    }
+    std::vector<int64_t> sequences;
+    std::vector<bool> endOfBatches;
+  } handler;
+
+  auto poller = ringBuffer->newPoller();
+  ringBuffer->addGatingSequences(poller->getSequence());
+  for (int i = 0; i < 5; ++i) {
+    ringBuffer->publish(ringBuffer->next());
+  }
+
+  EXPECT_EQ(PollerT::PollState::PROCESSING, poller->poll(handler, 2));
+  EXPECT_EQ((std::vector<int64_t>{0, 1}), handler.sequences);
+  EXPECT_EQ((std::vector<bool>{false, true}), handler.endOfBatches);
+
+  EXPECT_EQ(PollerT::PollState::PROCESSING, poller->poll(handler, 2));
+  EXPECT_EQ(PollerT::PollState::PROCESSING, poller->poll(handler, 2));
+  EXPECT_EQ((std::vector<int64_t>{0, 1, 2, 3, 4}), handler.sequences);
+  EXPECT_EQ(PollerT::PollState::IDLE, poller->poll(handler, 2));
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/EpochWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/MultiRingProcessor.h"
+#include "disruptor/RingBuffer.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/test_support/Await.h"
+#include "tests/disruptor/test_support/LongEventTestUtil.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using WS = disruptor::EpochWaitStrategy;
+using RingBufferT = disruptor::SingleProducerRingBuffer<LongEvent, WS>;
+using disruptor::test_support::RecordingHandler;
+using disruptor::test_support::awaitCondition;
+using disruptor::test_support::awaitCount;
+using disruptor::test_support::awaitSequence;
+using disruptor::test_support::publish;
+
+// Records which ring each event came from, in processing order.
+class OrderRecordingHandler final : public disruptor::EventHandler<LongEvent> {
+public:
+  OrderRecordingHandler(int ringId, std::vector<int> &order, std::mutex &mutex)
+      : ringId_(ringId), order_(&order), mutex_(&mutex) {}
+
+  void onEvent(LongEvent & /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    std::lock_guard<std::mutex> lock(*mutex_);
+    order_->push_back(ringId_);
+  }
+
+private:
+  int ringId_;
+  std::vector<int> *order_;
+  std::mutex *mutex_;
+};
+} // namespace
+
+TEST(MultiRingProcessorTest, shouldServiceManyRingsFromOneThread) {
+  WS waitStrategy;
+  constexpr int kRings = 8;
+  std::vector<std::shared_ptr<RingBufferT>> rings;
+  std::vector<std::unique_ptr<RecordingHandler>> handlers;
+  disruptor::MultiRingProcessor processor(waitStrategy);
+  for (int i = 0; i < kRings; ++i) {
+    rings.push_back(RingBufferT::createSingleProducer(LongEvent::FACTORY, 64, waitStrategy));
+    handlers.push_back(std::make_unique<RecordingHandler>());
+    processor.addRing(*rings.back(), *handlers.back());
+  }
+  EXPECT_EQ(kRings, processor.getRingCount());
+
+  std::thread thread([&] { processor.run(); });
+
+  // More events than the ring size, so the poller sequences must gate.
+  for (int64_t n = 0; n < 200; ++n) {
+    for (auto &ring : rings) {
+      publish(*ring, n);
+    }
+  }
+  for (auto &handler : handlers) {
+    ASSERT_TRUE(awaitCount(handler->count, 200));
+  }
+
+  processor.halt();
+  thread.join();
+  EXPECT_FALSE(processor.isRunning());
+}
+
+TEST(MultiRingProcessorTest, shouldLimitBatchPerRingSoBusyRingDoesNotStarveOthers) {
+  WS waitStrategy;
+  auto busy = RingBufferT::createSingleProducer(LongEvent::FACTORY, 128, waitStrategy);
+  auto quiet = RingBufferT::createSingleProducer(LongEvent::FACTORY, 128, waitStrategy);
+  std::vector<int> order;
+  std::mutex mutex;
+  OrderRecordingHandler busyHandler(0, order, mutex);
+  OrderRecordingHandler quietHandler(1, order, mutex);
+
+  disruptor::MultiRingProcessor processor(waitStrategy, 10);
+  processor.addRing(*busy, busyHandler);
+  processor.addRing(*quiet, quietHandler);
+
+  for (int64_t n = 0; n < 100; ++n) {
+    publish(*busy, n);
+  }
+  publish(*quiet, 0);
+
+  std::thread thread([&] { processor.run(); });
+  ASSERT_TRUE(awaitCondition([&] {
+    std::lock_guard<std::mutex> lock(mutex);
+    return order.size() == 101;
+  }));
+  processor.halt();
+  thread.join();
+
+  // First pass: 10 from the busy ring, then the quiet ring's event.
+  ASSERT_EQ(101u, order.size());
+  EXPECT_EQ(1, order[10]);
+}
+
+TEST(MultiRingProcessorTest, shouldWakeFromParkWhenAnyRingPublishes) {
+  WS waitStrategy;
+  auto first = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, waitStrategy);
+  auto second = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, waitStrategy);
+  RecordingHandler firstHandler, secondHandler;
+
+  disruptor::MultiRingProcessor processor(waitStrategy, 64, 1);
+  processor.addRing(*first, firstHandler);
+  processor.addRing(*second, secondHandler);
+  std::thread thread([&] { processor.run(); });
+
+  // Long enough for the processor to park.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  publish(*second, 1);
+  ASSERT_TRUE(awaitCount(secondHandler.count, 1));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  publish(*first, 1);
+  ASSERT_TRUE(awaitCount(firstHandler.count, 1));
+
+  processor.halt();
+  thread.join();
+}
+
+TEST(MultiRingProcessorTest, shouldHaltWhenDefaultExceptionHandlerRethrows) {
+  struct ThrowingHandler final : disruptor::EventHandler<LongEvent> {
+    void onEvent(LongEvent &event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+      if (event.get() == 1) {
+        throw std::runtime_error("bad event");
+      }
+    }
+  } handler;
+
+  WS waitStrategy;
+  auto ring = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, waitStrategy);
+  disruptor::MultiRingProcessor processor(waitStrategy);
+  disruptor::Sequence &sequence = processor.addRing(*ring, handler);
+
+  // The default handler is fatal; the processor must stop rather than let
+  // the rethrow escape its thread.
+  std::thread thread([&] { processor.run(); });
+  for (int64_t i = 0; i < 3; ++i) {
+    publish(*ring, i);
+  }
+  ASSERT_TRUE(awaitSequence(sequence, 1));
+  ASSERT_TRUE(awaitCondition([&] { return !processor.isRunning(); }));
+  thread.join();
+}
+
+TEST(MultiRingProcessorTest, shouldRejectRingWithDifferentWaitStrategyInstance) {
+  WS waitStrategy;
+  WS otherWaitStrategy;
+  auto ring = RingBufferT::createSingleProducer(LongEvent::FACTORY, 16, otherWaitStrategy);
+  RecordingHandler handler;
+
+  disruptor::MultiRingProcessor processor(waitStrategy);
+  EXPECT_THROW(processor.addRing(*ring, handler), std::invalid_argument);
+}
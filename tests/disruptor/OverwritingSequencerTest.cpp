@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/OverwritingSequencer.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/test_support/Await.h"
+#include "tests/disruptor/test_support/LongEventTestUtil.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using WS = disruptor::BusySpinWaitStrategy;
+using RingBufferT = disruptor::OverwritingRingBuffer<LongEvent, WS>;
+using disruptor::test_support::RecordingHandler;
+using disruptor::test_support::awaitSequence;
+using disruptor::test_support::publish;
+
+static_assert(disruptor::OverwritingSequencerType<disruptor::OverwritingSequencer<WS>>);
+static_assert(!disruptor::OverwritingSequencerType<disruptor::SingleProducerSequencer<WS>>);
+// EventPoller cannot see overwritten slots, so overwriting rings have no poller.
+template <typename R>
+concept HasPoller = requires(R &ringBuffer) { ringBuffer.newPoller(); };
+static_assert(!HasPoller<RingBufferT>);
+static_assert(HasPoller<disruptor::RingBuffer<LongEvent, disruptor::SingleProducerSequencer<WS>>>);
+} // namespace
+
+TEST(OverwritingSequencerTest, shouldNeverBlockProducerOnGatingSequences) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createOverwriting(LongEvent::FACTORY, 8, ws);
+  disruptor::Sequence stalled(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(stalled);
+
+  for (int64_t i = 0; i < 100; ++i) {
+    publish(*ringBuffer, i);
+  }
+
+  EXPECT_EQ(99, ringBuffer->getCursor());
+  EXPECT_TRUE(ringBuffer->hasAvailableCapacity(8));
+  EXPECT_TRUE(ringBuffer->tryClaim(8).has_value());
+  auto &sequencer = ringBuffer->getSequencer();
+  EXPECT_EQ(100, sequencer.getOldestIntactSequence());
+}
+
+TEST(OverwritingSequencerTest, shouldStampSlotsWhenPublishedAndClearThemWhenReclaimed) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createOverwriting(LongEvent::FACTORY, 8, ws);
+  auto &sequencer = ringBuffer->getSequencer();
+  for (int64_t i = 0; i < 8; ++i) {
+    publish(*ringBuffer, i);
+  }
+  EXPECT_TRUE(sequencer.isIntact(0));
+  EXPECT_TRUE(sequencer.isIntact(7));
+
+  // Claimed but not yet published: sequence 0's slot is being rewritten.
+  const int64_t claimed = ringBuffer->next();
+  EXPECT_EQ(8, claimed);
+  EXPECT_FALSE(sequencer.isIntact(0));
+  EXPECT_FALSE(sequencer.isIntact(8));
+  EXPECT_EQ(1, sequencer.getOldestIntactSequence());
+
+  ringBuffer->publish(claimed);
+  EXPECT_TRUE(sequencer.isIntact(8));
+  EXPECT_FALSE(sequencer.isIntact(0));
+}
+
+TEST(OverwritingSequencerTest, shouldClearStampsJumpedOverByClaim) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createOverwriting(LongEvent::FACTORY, 8, ws);
+  auto &sequencer = ringBuffer->getSequencer();
+  for (int64_t i = 0; i < 8; ++i) {
+    publish(*ringBuffer, i);
+  }
+
+  sequencer.claim(10);
+  EXPECT_FALSE(sequencer.isIntact(0));
+  EXPECT_FALSE(sequencer.isIntact(2));
+  EXPECT_TRUE(sequencer.isIntact(3));
+
+  // Moving back must not leave stamps that match sequences about to be reused.
+  sequencer.claim(3);
+  EXPECT_FALSE(sequencer.isIntact(4));
+  EXPECT_FALSE(sequencer.isIntact(7));
+  EXPECT_EQ(4, ringBuffer->next());
+}
+
+TEST(OverwritingSequencerTest, shouldSkipOverwrittenEventsAndCountThemAsDropped) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createOverwriting(LongEvent::FACTORY, 8, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build(*ringBuffer, *barrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  // Lap the processor before it starts: only the last 8 events survive.
+  for (int64_t i = 0; i < 20; ++i) {
+    publish(*ringBuffer, i * 10);
+  }
+  std::thread thread([&] { processor->run(); });
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), 19));
+  EXPECT_EQ(12, processor->getDroppedCount());
+
+  publish(*ringBuffer, 200);
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), 20));
+  processor->halt();
+  thread.join();
+
+  const std::vector<int64_t> sequences = handler.sequences();
+  const std::vector<int64_t> values = handler.values();
+  ASSERT_EQ(9u, sequences.size());
+  for (size_t i = 0; i < sequences.size(); ++i) {
+    EXPECT_EQ(static_cast<int64_t>(i) + 12, sequences[i]);
+    EXPECT_EQ(sequences[i] * 10, values[i]);
+  }
+  EXPECT_EQ(12, processor->getDroppedCount());
+}
+
+TEST(OverwritingSequencerTest, shouldOnlyDeliverIntactEventsWhileProducerLapsConsumer) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createOverwriting(LongEvent::FACTORY, 4, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build(*ringBuffer, *barrier, handler);
+
+  std::thread thread([&] { processor->run(); });
+  constexpr int64_t kEvents = 20000;
+  for (int64_t i = 0; i < kEvents; ++i) {
+    publish(*ringBuffer, i);
+  }
+  ASSERT_TRUE(awaitSequence(processor->getSequence(), kEvents - 1));
+  processor->halt();
+  thread.join();
+
+  const std::vector<int64_t> sequences = handler.sequences();
+  const std::vector<int64_t> values = handler.values();
+  for (size_t i = 0; i < sequences.size(); ++i) {
+    EXPECT_EQ(sequences[i], values[i]);
+    if (i > 0) {
+      EXPECT_LT(sequences[i - 1], sequences[i]);
+    }
+  }
+  EXPECT_EQ(kEvents, static_cast<int64_t>(sequences.size()) + processor->getDroppedCount());
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/ExceptionHandler.h"
+#include "disruptor/RingBridge.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/test_support/Await.h"
+#include "tests/disruptor/test_support/LongEventTestUtil.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using WS = disruptor::BusySpinWaitStrategy;
+using SourceRingT = disruptor::MultiProducerRingBuffer<LongEvent, WS>;
+using TargetRingT = disruptor::SingleProducerRingBuffer<LongEvent, WS>;
+using disruptor::test_support::awaitCondition;
+using disruptor::test_support::awaitSequence;
+using disruptor::test_support::publish;
+
+struct CopyTranslator {
+  void operator()(const LongEvent &source, LongEvent &target) const { target.set(source.get()); }
+};
+
+class CountingExceptionHandler final : public disruptor::ExceptionHandler<LongEvent> {
+public:
+  void handleEventException(const std::exception & /*ex*/, int64_t sequence, LongEvent * /*event*/) override {
+    failedSequence.store(sequence, std::memory_order_release);
+  }
+  void handleOnStartException(const std::exception & /*ex*/) override {}
+  void handleOnShutdownException(const std::exception & /*ex*/) override {}
+
+  std::atomic<int64_t> failedSequence{-1};
+};
+} // namespace
+
+TEST(RingBridgeTest, shouldForwardEventsFromMultiProducerRingInOrder) {
+  WS ws;
+  auto source = SourceRingT::createMultiProducer(LongEvent::FACTORY, 64, ws);
+  auto target = TargetRingT::createSingleProducer(LongEvent::FACTORY, 512, ws);
+  auto barrier = source->newBarrier();
+  disruptor::RingBridge bridge(*source, *barrier, *target, CopyTranslator{});
+  source->addGatingSequences(bridge.getSequence());
+
+  std::thread thread([&] { bridge.run(); });
+  constexpr int64_t kPerProducer = 200;
+  std::thread producerA([&] {
+    for (int64_t i = 0; i < kPerProducer; ++i) {
+      publish(*source, i);
+    }
+  });
+  std::thread producerB([&] {
+    for (int64_t i = 0; i < kPerProducer; ++i) {
+      publish(*source, 1000 + i);
+    }
+  });
+  producerA.join();
+  producerB.join();
+
+  ASSERT_TRUE(awaitSequence(*target, 2 * kPerProducer - 1));
+  bridge.halt();
+  thread.join();
+
+  // Each producer's events arrive in the order that producer published them.
+  int64_t nextA = 0;
+  int64_t nextB = 1000;
+  for (int64_t sequence = 0; sequence < 2 * kPerProducer; ++sequence) {
+    const int64_t value = target->get(sequence).get();
+    if (value < 1000) {
+      EXPECT_EQ(nextA++, value);
+    } else {
+      EXPECT_EQ(nextB++, value);
+    }
+  }
+  EXPECT_EQ(kPerProducer, nextA);
+  EXPECT_EQ(1000 + kPerProducer, nextB);
+}
+
+TEST(RingBridgeTest, shouldCapBatchAtSmallestTargetRing) {
+  WS ws;
+  auto source = SourceRingT::createMultiProducer(LongEvent::FACTORY, 64, ws);
+  auto small = TargetRingT::createSingleProducer(LongEvent::FACTORY, 8, ws);
+  auto large = TargetRingT::createSingleProducer(LongEvent::FACTORY, 32, ws);
+  auto barrier = source->newBarrier();
+
+  disruptor::RingBridge single(*source, *barrier, *large, CopyTranslator{}, 16);
+  EXPECT_EQ(16, single.getMaxBatchSize());
+
+  TargetRingT *targets[] = {large.get(), small.get()};
+  disruptor::RingBridge routed(*source, *barrier, targets, 2, CopyTranslator{},
+                               [](const LongEvent &, int64_t) { return size_t{0}; });
+  EXPECT_EQ(8, routed.getMaxBatchSize());
+
+  EXPECT_THROW(disruptor::RingBridge(*source, *barrier, *large, CopyTranslator{}, 0), std::invalid_argument);
+}
+
+TEST(RingBridgeTest, shouldRouteEventsToTargetsPreservingOrder) {
+  WS ws;
+  auto source = SourceRingT::createMultiProducer(LongEvent::FACTORY, 128, ws);
+  auto even = TargetRingT::createSingleProducer(LongEvent::FACTORY, 64, ws);
+  auto odd = TargetRingT::createSingleProducer(LongEvent::FACTORY, 64, ws);
+  auto barrier = source->newBarrier();
+
+  TargetRingT *targets[] = {even.get(), odd.get()};
+  disruptor::RingBridge bridge(*source, *barrier, targets, 2, CopyTranslator{},
+                               [](const LongEvent &event, int64_t) { return static_cast<size_t>(event.get() & 1); });
+  source->addGatingSequences(bridge.getSequence());
+
+  // Publish before starting so the whole backlog is split in one pass.
+  for (int64_t i = 0; i < 100; ++i) {
+    publish(*source, i);
+  }
+  std::thread thread([&] { bridge.run(); });
+  ASSERT_TRUE(awaitSequence(*even, 49));
+  ASSERT_TRUE(awaitSequence(*odd, 49));
+  bridge.halt();
+  thread.join();
+
+  EXPECT_EQ(99, bridge.getSequence().get());
+  for (int64_t i = 0; i < 50; ++i) {
+    EXPECT_EQ(2 * i, even->get(i).get());
+    EXPECT_EQ(2 * i + 1, odd->get(i).get());
+  }
+}
+
+TEST(RingBridgeTest, shouldPublishTargetSlotWhenTranslatorThrows) {
+  WS ws;
+  auto source = SourceRingT::createMultiProducer(LongEvent::FACTORY, 16, ws);
+  auto target = TargetRingT::createSingleProducer(LongEvent::FACTORY, 16, ws);
+  auto barrier = source->newBarrier();
+  disruptor::RingBridge bridge(*source, *barrier, *target, [](const LongEvent &from, LongEvent &to) {
+    if (from.get() == 2) {
+      throw std::runtime_error("cannot translate");
+    }
+    to.set(from.get());
+  });
+  CountingExceptionHandler exceptionHandler;
+  bridge.setExceptionHandler(exceptionHandler);
+  source->addGatingSequences(bridge.getSequence());
+
+  std::thread thread([&] { bridge.run(); });
+  for (int64_t i = 0; i < 5; ++i) {
+    publish(*source, i);
+  }
+  ASSERT_TRUE(awaitSequence(*target, 4));
+  EXPECT_TRUE(bridge.isRunning());
+  bridge.halt();
+  thread.join();
+
+  EXPECT_FALSE(bridge.isRunning());
+  EXPECT_EQ(2, exceptionHandler.failedSequence.load(std::memory_order_acquire));
+  EXPECT_EQ(3, target->get(3).get());
+  EXPECT_EQ(4, target->get(4).get());
+}
+
+TEST(RingBridgeTest, shouldHaltWhenDefaultExceptionHandlerRethrows) {
+  WS ws;
+  auto source = SourceRingT::createMultiProducer(LongEvent::FACTORY, 16, ws);
+  auto target = TargetRingT::createSingleProducer(LongEvent::FACTORY, 16, ws);
+  auto barrier = source->newBarrier();
+  disruptor::RingBridge bridge(*source, *barrier, *target, [](const LongEvent &from, LongEvent &to) {
+    if (from.get() == 1) {
+      throw std::runtime_error("cannot translate");
+    }
+    to.set(from.get());
+  });
+  source->addGatingSequences(bridge.getSequence());
+
+  // The default handler is fatal; the bridge must stop rather than let the
+  // rethrow escape its thread.
+  std::thread thread([&] { bridge.run(); });
+  for (int64_t i = 0; i < 3; ++i) {
+    publish(*source, i);
+  }
+  // The failed slot is still published before the bridge stops.
+  ASSERT_TRUE(awaitSequence(*target, 1));
+  ASSERT_TRUE(awaitCondition([&] { return !bridge.isRunning(); }));
+  thread.join();
+}
+
+TEST(RingBridgeTest, shouldDropEventWhenRouterFails) {
+  WS ws;
+  auto source = SourceRingT::createMultiProducer(LongEvent::FACTORY, 16, ws);
+  auto even = TargetRingT::createSingleProducer(LongEvent::FACTORY, 16, ws);
+  auto odd = TargetRingT::createSingleProducer(LongEvent::FACTORY, 16, ws);
+  auto barrier = source->newBarrier();
+
+  TargetRingT *targets[] = {even.get(), odd.get()};
+  disruptor::RingBridge bridge(*source, *barrier, targets, 2, CopyTranslator{},
+                               [](const LongEvent &event, int64_t) {
+                                 if (event.get() == 3) {
+                                   throw std::runtime_error("cannot route");
+                                 }
+                                 // 5 routes to a target that does not exist.
+                                 return event.get() == 5 ? size_t{2} : static_cast<size_t>(event.get() & 1);
+                               });
+  CountingExceptionHandler exceptionHandler;
+  bridge.setExceptionHandler(exceptionHandler);
+  source->addGatingSequences(bridge.getSequence());
+
+  std::thread thread([&] { bridge.run(); });
+  for (int64_t i = 0; i < 8; ++i) {
+    publish(*source, i);
+  }
+  ASSERT_TRUE(awaitSequence(*even, 3));
+  ASSERT_TRUE(awaitSequence(*odd, 1));
+  ASSERT_TRUE(awaitSequence(bridge.getSequence(), 7));
+  EXPECT_TRUE(bridge.isRunning());
+  bridge.halt();
+  thread.join();
+
+  EXPECT_EQ(5, exceptionHandler.failedSequence.load(std::memory_order_acquire));
+  EXPECT_EQ(1, odd->getCursor());
+  EXPECT_EQ(1, odd->get(0).get());
+  EXPECT_EQ(7, odd->get(1).get());
+}
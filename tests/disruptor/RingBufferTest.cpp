@@ -4,9 +4,14 @@
 #include "disruptor/NoOpEventProcessor.h"
 #include "disruptor/RingBuffer.h"
 #include "disruptor/Sequence.h"
+#include "tests/disruptor/support/LongEvent.h"
 #include "tests/disruptor/support/StubEvent.h"
 
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST(RingBufferTest, shouldClaimAndGet) {
   using Event = disruptor::support::StubEvent;
@@ -60,3 +65,116 @@ TEST(RingBufferTest, shouldThrowExceptionIfBufferIsFull) {
   }
   EXPECT_THROW((void)ringBuffer->tryNext(), disruptor::InsufficientCapacityException);
 }
+
+TEST(RingBufferTest, shouldPublishEventWithCallableTranslator) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  auto ringBuffer = disruptor::SingleProducerRingBuffer<Event, WS>::createSingleProducer(disruptor::support::StubEvent::EVENT_FACTORY, 4, ws);
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+
+  const std::string text = "foo";
+  ringBuffer->publishEvent([](Event &event, int64_t sequence, int value, const std::string &s) {
+    event.setValue(value + static_cast<int>(sequence));
+    event.setTestString(s);
+  }, 2701, text);
+  ringBuffer->publishEvent([](Event &event, int64_t) { event.setValue(7); });
+
+  EXPECT_EQ(2701, ringBuffer->get(0).getValue());
+  EXPECT_EQ("foo", ringBuffer->get(0).getTestString());
+  EXPECT_EQ(7, ringBuffer->get(1).getValue());
+  EXPECT_EQ(1, ringBuffer->getCursor());
+
+  EXPECT_TRUE(ringBuffer->tryPublishEvent([](Event &event, int64_t) { event.setValue(2); }));
+  EXPECT_TRUE(ringBuffer->tryPublishEvent([](Event &event, int64_t) { event.setValue(3); }));
+  EXPECT_FALSE(ringBuffer->tryPublishEvent([](Event &event, int64_t) { event.setValue(4); }));
+  EXPECT_EQ(3, ringBuffer->getCursor());
+}
+
+TEST(RingBufferTest, shouldPublishEventsFromArgumentRanges) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  auto ringBuffer = disruptor::SingleProducerRingBuffer<Event, WS>::createSingleProducer(disruptor::support::StubEvent::EVENT_FACTORY, 4, ws);
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+
+  const std::vector<int> values = {10, 11, 12};
+  const std::string names[] = {"a", "b", "c"};
+  auto translator = [](Event &event, int64_t, int value, const std::string &name) {
+    event.setValue(value);
+    event.setTestString(name);
+  };
+  ringBuffer->publishEvents(translator, values, std::span<const std::string>(names));
+
+  EXPECT_EQ(2, ringBuffer->getCursor());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(values[static_cast<size_t>(i)], ringBuffer->get(i).getValue());
+    EXPECT_EQ(names[i], ringBuffer->get(i).getTestString());
+  }
+
+  EXPECT_FALSE(ringBuffer->tryPublishEvents(translator, values, names));
+  EXPECT_EQ(2, ringBuffer->getCursor());
+  EXPECT_THROW(ringBuffer->publishEvents(translator, std::vector<int>{1}, names), std::invalid_argument);
+}
+
+TEST(RingBufferTest, shouldPublishClaimedSlotWhenCallableThrows) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  auto ringBuffer = disruptor::SingleProducerRingBuffer<Event, WS>::createSingleProducer(disruptor::support::StubEvent::EVENT_FACTORY, 4, ws);
+
+  EXPECT_THROW(ringBuffer->publishEvent([](Event &, int64_t) { throw std::runtime_error("translate"); }),
+               std::runtime_error);
+  EXPECT_EQ(0, ringBuffer->getCursor());
+}
+
+TEST(RingBufferTest, shouldPublishEventsFromSourceLargerThanBuffer) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  // No gating sequences, so the producer can lap the ring.
+  auto ringBuffer = disruptor::SingleProducerRingBuffer<Event, WS>::createSingleProducer(disruptor::support::StubEvent::EVENT_FACTORY, 8, ws);
+
+  std::vector<int> source(20);
+  for (int i = 0; i < 20; ++i) {
+    source[static_cast<size_t>(i)] = 100 + i;
+  }
+  ringBuffer->publishEvents(std::span<const int>(source), [](Event &event, int64_t, int value) { event.setValue(value); });
+
+  EXPECT_EQ(19, ringBuffer->getCursor());
+  for (int64_t sequence = 12; sequence <= 19; ++sequence) {
+    EXPECT_EQ(100 + sequence, ringBuffer->get(sequence).getValue());
+  }
+}
+
+TEST(RingBufferTest, shouldCopyRawEventsAcrossTheWrapPoint) {
+  using Event = disruptor::support::LongEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  auto ringBuffer = disruptor::SingleProducerRingBuffer<Event, WS>::createSingleProducer(Event::FACTORY, 8, ws);
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+
+  std::vector<Event> events(6);
+  for (int i = 0; i < 6; ++i) {
+    events[static_cast<size_t>(i)].set(i);
+  }
+  ringBuffer->publishRaw(events);
+  gating.set(ringBuffer->getCursor());
+
+  // Sequences 6..11 occupy slots 6, 7, 0, 1, 2, 3.
+  for (auto &event : events) {
+    event.set(event.get() + 6);
+  }
+  EXPECT_TRUE(ringBuffer->tryPublishRaw(events));
+  EXPECT_EQ(11, ringBuffer->getCursor());
+  for (int64_t sequence = 6; sequence <= 11; ++sequence) {
+    EXPECT_EQ(sequence, ringBuffer->get(sequence).get());
+  }
+
+  EXPECT_FALSE(ringBuffer->tryPublishRaw(events));
+  EXPECT_EQ(11, ringBuffer->getCursor());
+  EXPECT_THROW(ringBuffer->tryPublishRaw(std::vector<Event>(9)), std::invalid_argument);
+}
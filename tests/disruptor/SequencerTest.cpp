@@ -2,13 +2,17 @@
 
 #include "disruptor/BlockingWaitStrategy.h"
 #include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/InsufficientCapacityException.h"
 #include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/Sequence.h"
 #include "disruptor/SingleProducerSequencer.h"
 #include "disruptor/dsl/ProducerType.h"
 #include "tests/disruptor/support/DummyWaitStrategy.h"
 #include "tests/disruptor/test_support/CountDownLatch.h"
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <thread>
 
 namespace {
@@ -53,3 +57,34 @@ TEST(SequencerTest, shouldNotifyWaitStrategyOnPublish) {
   s->publish(s->next());
   EXPECT_EQ(ws.signalAllWhenBlockingCalls, 1);
 }
+
+TEST(SequencerTest, shouldReturnEmptyOptionalFromTryClaimWhenFull_single) {
+  using WS = disruptor::BlockingWaitStrategy;
+  WS ws;
+  auto s = newSingleProducer(BUFFER_SIZE, ws);
+  disruptor::Sequence gating;
+  disruptor::Sequence* gatingSequences[] = {&gating};
+  s->addGatingSequences(gatingSequences, 1);
+
+  EXPECT_EQ(std::optional<int64_t>(BUFFER_SIZE - 2), s->tryClaim(BUFFER_SIZE - 1));
+  EXPECT_EQ(std::nullopt, s->tryClaim(2));
+  EXPECT_EQ(std::optional<int64_t>(BUFFER_SIZE - 1), s->tryClaim());
+  EXPECT_EQ(std::nullopt, s->tryClaim());
+  EXPECT_THROW((void)s->tryNext(), disruptor::InsufficientCapacityException);
+}
+
+TEST(SequencerTest, shouldReturnEmptyOptionalFromTryClaimWhenFull_multi) {
+  using WS = disruptor::BlockingWaitStrategy;
+  WS ws;
+  auto s = newMultiProducer(BUFFER_SIZE, ws);
+  disruptor::Sequence gating;
+  disruptor::Sequence* gatingSequences[] = {&gating};
+  s->addGatingSequences(gatingSequences, 1);
+
+  EXPECT_EQ(std::optional<int64_t>(BUFFER_SIZE - 2), s->tryClaim(BUFFER_SIZE - 1));
+  EXPECT_EQ(std::nullopt, s->tryClaim(2));
+  EXPECT_EQ(BUFFER_SIZE - 2, s->getCursor());
+  EXPECT_EQ(std::optional<int64_t>(BUFFER_SIZE - 1), s->tryClaim());
+  EXPECT_EQ(std::nullopt, s->tryClaim());
+  EXPECT_THROW((void)s->tryNext(), disruptor::InsufficientCapacityException);
+}
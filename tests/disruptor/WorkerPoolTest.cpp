@@ -0,0 +1,160 @@
+// Port of com.lmax.disruptor.WorkerPoolTest from Disruptor 3.x, plus DSL and
+// batched-claim coverage.
+
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/FatalExceptionHandler.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/WorkHandler.h"
+#include "disruptor/WorkerPool.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+
+// Java: AtomicLong events incremented by each worker that sees them.
+class IncrementingWorkHandler final : public disruptor::WorkHandler<LongEvent> {
+public:
+  void onEvent(LongEvent &event) override { event.set(event.get() + 1); }
+};
+
+using RingBufferT = disruptor::MultiProducerRingBuffer<LongEvent, disruptor::BlockingWaitStrategy>;
+using BarrierT = decltype(std::declval<RingBufferT &>().newBarrier())::element_type;
+using WorkerPoolT = disruptor::WorkerPool<LongEvent, RingBufferT, BarrierT>;
+
+class RecordingWorkHandler final : public disruptor::WorkHandler<LongEvent> {
+public:
+  void onEvent(LongEvent &event) override {
+    values.push_back(event.get());
+    count.fetch_add(1, std::memory_order_release);
+  }
+
+  std::vector<int64_t> values;
+  std::atomic<int64_t> count{0};
+};
+
+void awaitTotal(std::initializer_list<RecordingWorkHandler *> handlers, int64_t expected) {
+  while (true) {
+    int64_t total = 0;
+    for (auto *handler : handlers) {
+      total += handler->count.load(std::memory_order_acquire);
+    }
+    if (total >= expected) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+} // namespace
+
+TEST(WorkerPoolTest, shouldProcessEachMessageByOnlyOneWorker) {
+  disruptor::BlockingWaitStrategy ws;
+  auto ringBuffer = RingBufferT::createMultiProducer(LongEvent::FACTORY, 1024, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::FatalExceptionHandler<LongEvent> exceptionHandler;
+  IncrementingWorkHandler h0, h1;
+  disruptor::WorkHandler<LongEvent> *handlers[] = {&h0, &h1};
+  WorkerPoolT pool(*ringBuffer, *barrier, exceptionHandler, handlers, 2);
+  auto workerSequences = pool.getWorkerSequences();
+  ringBuffer->addGatingSequences(workerSequences.data(), static_cast<int>(workerSequences.size()));
+  pool.start(disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  ringBuffer->next();
+  ringBuffer->next();
+  ringBuffer->publish(0);
+  ringBuffer->publish(1);
+
+  pool.drainAndHalt();
+  pool.join();
+
+  EXPECT_EQ(1, ringBuffer->get(0).get());
+  EXPECT_EQ(1, ringBuffer->get(1).get());
+}
+
+TEST(WorkerPoolTest, shouldProcessOnlyOnceItHasBeenPublished) {
+  disruptor::BlockingWaitStrategy ws;
+  auto ringBuffer = RingBufferT::createMultiProducer(LongEvent::FACTORY, 1024, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::FatalExceptionHandler<LongEvent> exceptionHandler;
+  IncrementingWorkHandler h0, h1;
+  disruptor::WorkHandler<LongEvent> *handlers[] = {&h0, &h1};
+  WorkerPoolT pool(*ringBuffer, *barrier, exceptionHandler, handlers, 2);
+  auto workerSequences = pool.getWorkerSequences();
+  ringBuffer->addGatingSequences(workerSequences.data(), static_cast<int>(workerSequences.size()));
+  pool.start(disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  ringBuffer->next();
+  ringBuffer->next();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  EXPECT_EQ(0, ringBuffer->get(0).get());
+  EXPECT_EQ(0, ringBuffer->get(1).get());
+
+  pool.halt();
+  pool.join();
+}
+
+TEST(WorkerPoolTest, shouldShareEventsAcrossWorkerPoolInDisruptor) {
+  disruptor::dsl::Disruptor<LongEvent, disruptor::dsl::ProducerType::SINGLE, disruptor::BlockingWaitStrategy> d(
+      LongEvent::FACTORY, 64, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingWorkHandler w0, w1, w2;
+  d.handleEventsWithWorkerPool(w0, w1, w2);
+  auto ringBuffer = d.start();
+
+  constexpr int64_t kEvents = 5000;
+  for (int64_t i = 0; i < kEvents; ++i) {
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).set(i);
+    ringBuffer->publish(sequence);
+  }
+  awaitTotal({&w0, &w1, &w2}, kEvents);
+  d.halt();
+  d.join();
+
+  std::set<int64_t> seen;
+  for (auto *handler : {&w0, &w1, &w2}) {
+    for (int64_t value : handler->values) {
+      EXPECT_TRUE(seen.insert(value).second) << "value " << value << " processed twice";
+    }
+  }
+  EXPECT_EQ(static_cast<size_t>(kEvents), seen.size());
+}
+
+TEST(WorkerPoolTest, shouldClaimInBatchesAndGateDownstreamHandlers) {
+  disruptor::dsl::Disruptor<LongEvent, disruptor::dsl::ProducerType::SINGLE, disruptor::BlockingWaitStrategy> d(
+      LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingWorkHandler w0, w1;
+  RecordingWorkHandler after;
+  disruptor::WorkHandler<LongEvent> *workers[] = {&w0, &w1};
+  d.handleEventsWithWorkerPool(workers, 2, 8).thenHandleEventsWithWorkerPool(after);
+  auto ringBuffer = d.start();
+
+  constexpr int64_t kEvents = 1000;
+  for (int64_t i = 0; i < kEvents; ++i) {
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).set(i);
+    ringBuffer->publish(sequence);
+  }
+  awaitTotal({&after}, kEvents);
+  d.halt();
+  d.join();
+
+  EXPECT_EQ(kEvents, w0.count.load() + w1.count.load());
+  // A single downstream worker sees the events in ring order.
+  for (int64_t i = 0; i < kEvents; ++i) {
+    ASSERT_EQ(i, after.values[static_cast<size_t>(i)]);
+  }
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/DisruptorMetrics.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/dsl/stubs/DelayedEventHandler.h"
+#include "tests/disruptor/support/TestEvent.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace {
+using DisruptorT =
+    disruptor::dsl::Disruptor<disruptor::support::TestEvent,
+                              disruptor::dsl::ProducerType::SINGLE,
+                              disruptor::BlockingWaitStrategy>;
+
+void publish(DisruptorT &d) {
+  auto &ringBuffer = d.getRingBuffer();
+  ringBuffer.publish(ringBuffer.next());
+}
+} // namespace
+
+TEST(DisruptorMetricsTest, shouldReportConsumerLagAndProducerWrapWaits) {
+  DisruptorT d(disruptor::support::TestEvent::EVENT_FACTORY, 4,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  disruptor::dsl::stubs::DelayedEventHandler handler;
+  d.handleEventsWith(handler);
+  d.start();
+  handler.awaitStart();
+
+  for (int i = 0; i < 4; ++i) {
+    publish(d);
+  }
+
+  auto full = d.getMetrics();
+  EXPECT_EQ(3, full.cursor);
+  EXPECT_EQ(4, full.bufferSize);
+  EXPECT_EQ(0, full.remainingCapacity);
+  ASSERT_EQ(1u, full.consumers.size());
+  EXPECT_EQ(-1, full.consumers[0].sequence);
+  EXPECT_EQ(4, full.consumers[0].lag);
+  EXPECT_EQ(4, full.consumers[0].maxSampledLag);
+  EXPECT_TRUE(full.consumers[0].endOfChain);
+  EXPECT_EQ(0u, full.wrapWaitCount);
+
+  // The fifth claim must wait for the consumer to free a slot. The handler is
+  // released from another thread so every publish stays on this one, as a
+  // single-producer ring requires.
+  std::thread releaser([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (int i = 0; i < 5; ++i) {
+      handler.processEvent();
+    }
+  });
+  publish(d);
+  releaser.join();
+
+  while (d.getMetrics().consumers[0].sequence < 4) {
+    std::this_thread::yield();
+  }
+
+  auto drained = d.getMetrics();
+  EXPECT_EQ(4, drained.cursor);
+  EXPECT_EQ(0, drained.consumers[0].lag);
+  EXPECT_EQ(4, drained.consumers[0].maxSampledLag);
+  EXPECT_EQ(1u, drained.wrapWaitCount);
+  EXPECT_GT(drained.wrapWaitNanos, 0);
+  EXPECT_GE(drained.publishRatePerSecond, 0.0);
+
+  handler.stopWaiting();
+  d.halt();
+}
+
+TEST(DisruptorMetricsTest, shouldKeepMaxSampledLagWhenAnotherHandlerIsRemoved) {
+  DisruptorT d(disruptor::support::TestEvent::EVENT_FACTORY, 4,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  disruptor::dsl::stubs::DelayedEventHandler handler;
+  d.handleEventsWith(handler);
+  d.start();
+  handler.awaitStart();
+
+  for (int i = 0; i < 4; ++i) {
+    publish(d);
+  }
+  EXPECT_EQ(4, d.getMetrics().consumers[0].maxSampledLag);
+  for (int i = 0; i < 4; ++i) {
+    handler.processEvent();
+  }
+  while (d.getMetrics().consumers[0].sequence < 3) {
+    std::this_thread::yield();
+  }
+
+  struct NoOpHandler final : disruptor::EventHandler<disruptor::support::TestEvent> {
+    void onEvent(disruptor::support::TestEvent & /*event*/, int64_t /*sequence*/,
+                 bool /*endOfBatch*/) override {}
+  } transient;
+  d.addHandlerWhileRunning(transient);
+  EXPECT_TRUE(d.removeHandlerWhileRunning(transient));
+
+  auto after = d.getMetrics();
+  ASSERT_EQ(1u, after.consumers.size());
+  EXPECT_EQ(0, after.consumers[0].lag);
+  EXPECT_EQ(4, after.consumers[0].maxSampledLag);
+
+  handler.stopWaiting();
+  d.halt();
+}
+
+TEST(DisruptorMetricsTest, shouldRenderPrometheusAndJson) {
+  disruptor::dsl::DisruptorMetrics metrics;
+  metrics.cursor = 10;
+  metrics.bufferSize = 16;
+  metrics.remainingCapacity = 12;
+  metrics.wrapWaitCount = 2;
+  disruptor::dsl::ConsumerMetrics consumer;
+  consumer.index = 0;
+  consumer.sequence = 6;
+  consumer.lag = 4;
+  consumer.maxSampledLag = 9;
+  metrics.consumers.push_back(consumer);
+
+  const std::string text = disruptor::dsl::toPrometheus(metrics, "orders");
+  EXPECT_NE(std::string::npos, text.find("orders_cursor 10\n"));
+  EXPECT_NE(std::string::npos, text.find("# TYPE orders_wrap_wait_total counter\n"));
+  EXPECT_NE(std::string::npos, text.find("orders_consumer_lag{consumer=\"0\"} 4\n"));
+  EXPECT_NE(std::string::npos, text.find("orders_consumer_max_sampled_lag{consumer=\"0\"} 9\n"));
+
+  const std::string json = disruptor::dsl::toJson(metrics);
+  EXPECT_NE(std::string::npos, json.find("\"cursor\":10"));
+  EXPECT_NE(std::string::npos, json.find("\"consumers\":[{\"index\":0,\"sequence\":6,\"lag\":4,\"maxSampledLag\":9"));
+}
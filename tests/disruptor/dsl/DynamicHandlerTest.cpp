@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/test_support/Await.h"
+#include "tests/disruptor/test_support/LongEventTestUtil.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using disruptor::test_support::RecordingHandler;
+using disruptor::test_support::awaitCondition;
+using disruptor::test_support::awaitCount;
+using disruptor::test_support::publish;
+using DisruptorT = disruptor::dsl::Disruptor<LongEvent, disruptor::dsl::ProducerType::SINGLE,
+                                             disruptor::BlockingWaitStrategy>;
+} // namespace
+
+TEST(DynamicHandlerTest, shouldAttachHandlerToRunningDisruptorAtCurrentCursor) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler first;
+  d.handleEventsWith(first);
+  d.start();
+
+  for (int64_t i = 0; i < 10; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCount(first.count, 10));
+
+  RecordingHandler late;
+  d.addHandlerWhileRunning(late);
+  EXPECT_EQ(2, d.getProcessorCount());
+  EXPECT_EQ(9, d.getSequenceValueFor(late));
+
+  // More than the ring size, so the new handler must be gating.
+  for (int64_t i = 10; i < 50; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCount(late.count, 40));
+
+  const std::vector<int64_t> values = late.values();
+  ASSERT_EQ(40u, values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(static_cast<int64_t>(i) + 10, values[i]);
+  }
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldDrainHandlerBeforeRemovingIt) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler fast;
+  RecordingHandler slow(std::chrono::microseconds(500));
+  d.handleEventsWith(fast, slow);
+  d.start();
+
+  for (int64_t i = 0; i < 16; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  EXPECT_TRUE(d.removeHandlerWhileRunning(slow));
+  EXPECT_EQ(16, slow.count.load(std::memory_order_acquire));
+  EXPECT_EQ(1, d.getProcessorCount());
+  EXPECT_FALSE(d.removeHandlerWhileRunning(slow));
+
+  // The removed handler no longer gates the ring buffer.
+  for (int64_t i = 16; i < 100; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCount(fast.count, 100));
+  EXPECT_EQ(16, slow.count.load(std::memory_order_acquire));
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldAttachHandlerBehindExistingHandler) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler upstream(std::chrono::microseconds(200));
+  d.handleEventsWith(upstream);
+  d.start();
+
+  RecordingHandler downstream;
+  disruptor::EventHandlerIdentity *after[] = {&upstream};
+  d.addHandlerWhileRunning(downstream, after, 1);
+
+  for (int64_t i = 0; i < 20; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCondition([&] {
+    const int64_t handled = downstream.count.load(std::memory_order_acquire);
+    EXPECT_GE(upstream.count.load(std::memory_order_acquire), handled);
+    return handled >= 20;
+  }));
+
+  // Something now waits on upstream, so it cannot be detached on its own.
+  EXPECT_THROW(d.removeHandlerWhileRunning(upstream), std::invalid_argument);
+  EXPECT_TRUE(d.removeHandlerWhileRunning(downstream));
+
+  // Nothing waits on upstream any more: it is end-of-chain again.
+  EXPECT_TRUE(d.removeHandlerWhileRunning(upstream));
+  EXPECT_EQ(0, d.getProcessorCount());
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldKeepUpstreamUsedWhileAnotherDependentRemains) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler upstream;
+  RecordingHandler staticDependent;
+  d.handleEventsWith(upstream).then(staticDependent);
+  d.start();
+
+  RecordingHandler runtimeDependent;
+  disruptor::EventHandlerIdentity *after[] = {&upstream};
+  d.addHandlerWhileRunning(runtimeDependent, after, 1);
+  EXPECT_TRUE(d.removeHandlerWhileRunning(runtimeDependent));
+
+  // staticDependent still waits on upstream.
+  EXPECT_THROW(d.removeHandlerWhileRunning(upstream), std::invalid_argument);
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldNotDeadlockWhenRemovedHandlerCallsDisruptorOnShutdown) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler other;
+  d.handleEventsWith(other);
+  d.start();
+
+  struct ShutdownProbe final : disruptor::EventHandler<LongEvent> {
+    explicit ShutdownProbe(DisruptorT &disruptor) : disruptor_(&disruptor) {}
+    void onEvent(LongEvent & /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {}
+    void onShutdown() override { shutdownCount = disruptor_->getProcessorCount(); }
+    DisruptorT *disruptor_;
+    int shutdownCount = -1;
+  } probe(d);
+  d.addHandlerWhileRunning(probe);
+
+  publish(d.getRingBuffer(), 1);
+  EXPECT_TRUE(d.removeHandlerWhileRunning(probe));
+  EXPECT_EQ(1, probe.shutdownCount);
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldRejectAttachBeforeStartOrTwice) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler handler;
+  EXPECT_THROW(d.addHandlerWhileRunning(handler), std::runtime_error);
+
+  d.handleEventsWith(handler);
+  d.start();
+  EXPECT_THROW(d.addHandlerWhileRunning(handler), std::invalid_argument);
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldRejectRemovingPartitionHandler) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler h0;
+  RecordingHandler h1;
+  d.handleEventsWithPartitioned([](const LongEvent &event) { return event.get(); }, h0, h1);
+  d.start();
+
+  EXPECT_THROW(d.removeHandlerWhileRunning(h0), std::invalid_argument);
+
+  // The dispatcher still delivers through both partitions.
+  publish(d.getRingBuffer(), 0);
+  publish(d.getRingBuffer(), 1);
+  ASSERT_TRUE(awaitCondition([&] { return h0.count.load() + h1.count.load() == 2; }));
+
+  d.halt();
+  d.join();
+}
+
+TEST(DynamicHandlerTest, shouldJoinWhileHandlerIsBeingRemoved) {
+  DisruptorT d(LongEvent::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler other;
+  d.handleEventsWith(other);
+  d.start();
+
+  RecordingHandler transient;
+  d.addHandlerWhileRunning(transient);
+  publish(d.getRingBuffer(), 1);
+  ASSERT_TRUE(awaitCount(transient.count, 1));
+
+  // Both paths join the removed handler's thread.
+  std::thread remover([&] { d.removeHandlerWhileRunning(transient); });
+  d.halt();
+  d.join();
+  remover.join();
+}
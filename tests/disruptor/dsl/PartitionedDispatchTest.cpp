@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/IgnoreExceptionHandler.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/test_support/Await.h"
+#include "tests/disruptor/test_support/LongEventTestUtil.h"
+
+#include <cstdint>
+#include <atomic>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using disruptor::test_support::RecordingHandler;
+using disruptor::test_support::awaitCondition;
+using disruptor::test_support::awaitCount;
+using disruptor::test_support::publish;
+using DisruptorT =
+    disruptor::dsl::Disruptor<LongEvent, disruptor::dsl::ProducerType::SINGLE,
+                              disruptor::BlockingWaitStrategy>;
+
+constexpr int64_t kKeys = 16;
+
+int64_t keyOf(const LongEvent &event) { return event.get() % kKeys; }
+} // namespace
+
+TEST(PartitionedDispatchTest, shouldDeliverEachKeyToOneHandlerInOrder) {
+  DisruptorT d(LongEvent::FACTORY, 64,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler h0, h1, h2, h3;
+  d.handleEventsWithPartitioned(keyOf, h0, h1, h2, h3);
+  d.start();
+
+  constexpr int64_t kEvents = 10000;
+  for (int64_t i = 0; i < kEvents; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  d.shutdown();
+
+  std::map<int64_t, RecordingHandler *> owner;
+  int64_t total = 0;
+  for (RecordingHandler *handler : {&h0, &h1, &h2, &h3}) {
+    std::map<int64_t, int64_t> last;
+    for (int64_t value : handler->values()) {
+      const int64_t key = value % kKeys;
+      auto [it, inserted] = owner.emplace(key, handler);
+      EXPECT_EQ(handler, it->second) << "key " << key << " split across handlers";
+      if (last.count(key) != 0) {
+        EXPECT_LT(last[key], value);
+      }
+      last[key] = value;
+    }
+    total += static_cast<int64_t>(handler->values().size());
+  }
+  EXPECT_EQ(kEvents, total);
+  EXPECT_EQ(kKeys, static_cast<int64_t>(owner.size()));
+}
+
+TEST(PartitionedDispatchTest, shouldNotHoldBackProducerWhenPartitionIsIdle) {
+  DisruptorT d(LongEvent::FACTORY, 8,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler busy, idle;
+  disruptor::EventHandlerBase<LongEvent> *handlers[] = {&busy, &idle};
+  d.handleEventsWithPartitioned([](const LongEvent &) { return 0; }, handlers,
+                                2);
+  d.start();
+
+  // Many times the ring size, all for one partition.
+  for (int64_t i = 0; i < 100; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCount(busy.count, 100));
+  ASSERT_TRUE(awaitCondition([&] { return d.getSequenceValueFor(idle) >= 99; }));
+
+  EXPECT_TRUE(idle.values().empty());
+  d.halt();
+}
+
+TEST(PartitionedDispatchTest, shouldGateDownstreamHandlersOnAllPartitions) {
+  DisruptorT d(LongEvent::FACTORY, 32,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler h0, h1, h2;
+  RecordingHandler after;
+  d.handleEventsWithPartitioned(keyOf, h0, h1, h2).then(after);
+  d.start();
+
+  constexpr int64_t kEvents = 1000;
+  for (int64_t i = 0; i < kEvents; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCount(after.count, kEvents));
+  d.halt();
+
+  EXPECT_EQ(kEvents, h0.count.load() + h1.count.load() + h2.count.load());
+  const std::vector<int64_t> values = after.values();
+  for (int64_t i = 0; i < kEvents; ++i) {
+    ASSERT_EQ(i, values[static_cast<size_t>(i)]);
+  }
+}
+
+TEST(PartitionedDispatchTest, shouldSkipOnlyTheEntryWhoseHandlerFailed) {
+  struct FailingHandler final : disruptor::EventHandler<LongEvent> {
+    void onBatchStart(int64_t /*batchSize*/, int64_t /*queueDepth*/) override {
+      if (!batchStartFailed.exchange(true)) {
+        throw std::runtime_error("onBatchStart");
+      }
+    }
+    void onEvent(LongEvent &event, int64_t sequence, bool endOfBatch) override {
+      if (event.get() == 3) {
+        throw std::runtime_error("onEvent");
+      }
+      recorder.onEvent(event, sequence, endOfBatch);
+    }
+    std::atomic<bool> batchStartFailed{false};
+    RecordingHandler recorder;
+  } handler;
+
+  DisruptorT d(LongEvent::FACTORY, 16,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  disruptor::IgnoreExceptionHandler<LongEvent> ignore;
+  d.handleExceptionsWith(ignore);
+  d.handleEventsWithPartitioned(keyOf, handler);
+  d.start();
+
+  for (int64_t i = 0; i < 6; ++i) {
+    publish(d.getRingBuffer(), i);
+  }
+  ASSERT_TRUE(awaitCount(handler.recorder.count, 5));
+  d.halt();
+
+  // The failed onBatchStart skipped nothing; only the event whose onEvent
+  // threw was dropped.
+  EXPECT_EQ((std::vector<int64_t>{0, 1, 2, 4, 5}), handler.recorder.values());
+}
+
+TEST(PartitionedDispatchTest, shouldRejectEmptyPartitionList) {
+  DisruptorT d(LongEvent::FACTORY, 8,
+               disruptor::util::DaemonThreadFactory::INSTANCE());
+  EXPECT_THROW(d.handleEventsWithPartitioned(keyOf, nullptr, 0),
+               std::invalid_argument);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/dsl/ShardedDisruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/test_support/Await.h"
+#include "tests/disruptor/test_support/LongEventTestUtil.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using disruptor::support::LongEvent;
+using disruptor::test_support::RecordingHandler;
+using disruptor::test_support::awaitCount;
+using disruptor::test_support::awaitSequence;
+using disruptor::test_support::publish;
+using WS = disruptor::BlockingWaitStrategy;
+
+struct ValueKey {
+  int64_t operator()(const LongEvent &event) const { return event.get(); }
+};
+} // namespace
+
+TEST(ShardedDisruptorTest, shouldMergeEveryShardIntoHandlerGraph) {
+  constexpr int kProducers = 4;
+  constexpr int64_t kPerProducer = 500;
+  disruptor::dsl::ShardedDisruptor<LongEvent, WS> sharded(
+      LongEvent::FACTORY, kProducers, 32, 64, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler first;
+  RecordingHandler second;
+  sharded.handleEventsWith(first).then(second);
+  sharded.start();
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&sharded, p] {
+      auto &ringBuffer = sharded.claimShard();
+      for (int64_t i = 0; i < kPerProducer; ++i) {
+        publish(ringBuffer, p * 10000 + i);
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  ASSERT_TRUE(awaitCount(second.count, kProducers * kPerProducer));
+
+  // No cross-shard order, but each producer's events stay in order.
+  const std::vector<int64_t> values = second.values();
+  ASSERT_EQ(static_cast<size_t>(kProducers * kPerProducer), values.size());
+  std::vector<int64_t> nextPerProducer(kProducers, 0);
+  for (const int64_t value : values) {
+    const int64_t producer = value / 10000;
+    EXPECT_EQ(nextPerProducer[producer]++, value % 10000);
+  }
+  EXPECT_EQ(first.values(), values);
+
+  sharded.shutdown();
+  sharded.join();
+}
+
+TEST(ShardedDisruptorTest, shouldMergeVisibleEventsByKey) {
+  disruptor::dsl::ShardedDisruptor<LongEvent, WS, ValueKey> sharded(
+      LongEvent::FACTORY, 3, 16, 64, disruptor::util::DaemonThreadFactory::INSTANCE());
+  RecordingHandler handler;
+  sharded.handleEventsWith(handler);
+
+  // Published before start, so a single pass sees all of them.
+  for (int64_t i = 0; i < 10; ++i) {
+    publish(sharded.getShard(static_cast<int>(i % 3)), i);
+  }
+  sharded.start();
+  ASSERT_TRUE(awaitCount(handler.count, 10));
+
+  const std::vector<int64_t> values = handler.values();
+  for (int64_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(i, values[static_cast<size_t>(i)]);
+  }
+
+  sharded.halt();
+  sharded.join();
+}
+
+TEST(ShardedDisruptorTest, shouldKeepKeyOrderWhenShardHoldsMoreThanMaxBatch) {
+  disruptor::dsl::ShardedDisruptor<LongEvent, WS, ValueKey> sharded(
+      LongEvent::FACTORY, 3, 16, 64, disruptor::util::DaemonThreadFactory::INSTANCE(), ValueKey{}, 2);
+  RecordingHandler handler;
+  sharded.handleEventsWith(handler);
+
+  const std::vector<std::vector<int64_t>> shardValues{{1, 2, 3, 4, 5}, {10, 11}, {4, 12}};
+  for (size_t s = 0; s < shardValues.size(); ++s) {
+    for (const int64_t value : shardValues[s]) {
+      publish(sharded.getShard(static_cast<int>(s)), value);
+    }
+  }
+  sharded.start();
+  ASSERT_TRUE(awaitCount(handler.count, 9));
+
+  const std::vector<int64_t> expected{1, 2, 3, 4, 4, 5, 10, 11, 12};
+  EXPECT_EQ(expected, handler.values());
+
+  sharded.halt();
+  sharded.join();
+}
+
+TEST(ShardedDisruptorTest, shouldHaltWhileMergedRingIsFullAndConsumersHaveStopped) {
+  struct ThrowingHandler final : disruptor::EventHandler<LongEvent> {
+    void onEvent(LongEvent & /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+      throw std::runtime_error("bad event");
+    }
+  } handler;
+
+  disruptor::dsl::ShardedDisruptor<LongEvent, WS> sharded(
+      LongEvent::FACTORY, 1, 16, 4, disruptor::util::DaemonThreadFactory::INSTANCE());
+  // The default handler is fatal, so the consumer halts on the first event
+  // and the merged ring fills up behind it.
+  sharded.handleEventsWith(handler);
+  sharded.start();
+  for (int64_t i = 0; i < 8; ++i) {
+    publish(sharded.getShard(0), i);
+  }
+  ASSERT_TRUE(awaitSequence(sharded.getDisruptor().getRingBuffer(), 3));
+
+  sharded.halt();
+  sharded.join();
+}
+
+TEST(ShardedDisruptorTest, shouldRejectClaimingMoreShardsThanConfigured) {
+  disruptor::dsl::ShardedDisruptor<LongEvent, WS> sharded(
+      LongEvent::FACTORY, 2, 16, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  auto &first = sharded.claimShard();
+  auto &second = sharded.claimShard();
+  EXPECT_NE(&first, &second);
+  EXPECT_THROW(sharded.claimShard(), std::runtime_error);
+  EXPECT_THROW((disruptor::dsl::ShardedDisruptor<LongEvent, WS>(
+                   LongEvent::FACTORY, 0, 16, 16, disruptor::util::DaemonThreadFactory::INSTANCE())),
+               std::invalid_argument);
+}
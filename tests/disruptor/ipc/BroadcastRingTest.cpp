@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/ipc/BroadcastRing.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace {
+using disruptor::ipc::BroadcastRing;
+using disruptor::ipc::BroadcastSubscriber;
+using disruptor::ipc::SlowSubscriberPolicy;
+
+struct Quote {
+  int64_t id;
+  double price;
+};
+
+using RingT = BroadcastRing<Quote>;
+using SubscriberT = BroadcastSubscriber<Quote>;
+
+std::string segmentName(const char *test) {
+  return "/nano-stream-" + std::string(test) + "-" + std::to_string(::getpid());
+}
+
+void publish(RingT &ring, int64_t id) {
+  const int64_t sequence = ring.next();
+  ring.get(sequence) = Quote{id, static_cast<double>(id) / 2};
+  ring.publish(sequence);
+}
+
+// Reads count events in order, checking ids; returns the number that matched.
+int64_t consume(SubscriberT &subscriber, int64_t count) {
+  int64_t expected = 0;
+  int64_t matched = 0;
+  while (expected < count) {
+    subscriber.poll([&](const Quote &quote, int64_t /*sequence*/, bool /*endOfBatch*/) {
+      if (quote.id == expected && quote.price == static_cast<double>(expected) / 2) {
+        ++matched;
+      }
+      ++expected;
+    });
+  }
+  return matched;
+}
+} // namespace
+
+TEST(BroadcastRingTest, shouldDeliverEveryEventToEachSubscriberWhileGatingPublisher) {
+  const std::string name = segmentName("gating");
+  RingT ring = RingT::create(name, 16, 4);
+  RingT readerMapping = RingT::open(name);
+
+  constexpr int64_t kEvents = 2000;
+  SubscriberT first(readerMapping);
+  SubscriberT second(readerMapping);
+  EXPECT_EQ(2, ring.getActiveSubscriberCount());
+
+  std::atomic<int64_t> firstMatched{0};
+  std::atomic<int64_t> secondMatched{0};
+  std::thread firstThread([&] { firstMatched = consume(first, kEvents); });
+  std::thread secondThread([&] { secondMatched = consume(second, kEvents); });
+  for (int64_t i = 0; i < kEvents; ++i) {
+    publish(ring, i);
+  }
+  firstThread.join();
+  secondThread.join();
+
+  EXPECT_EQ(kEvents, firstMatched.load());
+  EXPECT_EQ(kEvents, secondMatched.load());
+  EXPECT_EQ(kEvents - 1, ring.getMinimumSubscriberSequence());
+  EXPECT_EQ(0, ring.getDroppedCount());
+}
+
+TEST(BroadcastRingTest, shouldDropLaggardInsteadOfBlockingPublisher) {
+  const std::string name = segmentName("drop");
+  RingT ring = RingT::create(name, 8, 2, SlowSubscriberPolicy::DROP_SUBSCRIBER);
+  SubscriberT laggard(ring);
+
+  // Three times round the ring with nobody reading: the publisher must not block.
+  for (int64_t i = 0; i < 24; ++i) {
+    publish(ring, i);
+  }
+  EXPECT_EQ(1, ring.getDroppedCount());
+  EXPECT_EQ(0, ring.getActiveSubscriberCount());
+  EXPECT_FALSE(ring.isSubscriberActive(laggard.getSlot()));
+
+  int handled = 0;
+  auto countEvents = [&](const Quote &, int64_t, bool) { ++handled; };
+  EXPECT_EQ(SubscriberT::PollState::DROPPED, laggard.poll(countEvents));
+  EXPECT_EQ(0, handled);
+
+  laggard.rejoin();
+  EXPECT_EQ(23, laggard.getSequence());
+  EXPECT_EQ(SubscriberT::PollState::IDLE, laggard.poll(countEvents));
+  publish(ring, 24);
+  Quote received{};
+  EXPECT_EQ(SubscriberT::PollState::PROCESSING,
+            laggard.poll([&](const Quote &quote, int64_t, bool) { received = quote; }));
+  EXPECT_EQ(24, received.id);
+}
+
+TEST(BroadcastRingTest, shouldReleaseGatingWhenSubscriberLeavesOrIsEvicted) {
+  const std::string name = segmentName("evict");
+  RingT ring = RingT::create(name, 8, 2);
+  auto stalled = std::make_unique<SubscriberT>(ring);
+  SubscriberT dead(ring);
+  for (int64_t i = 0; i < 8; ++i) {
+    publish(ring, i);
+  }
+  EXPECT_EQ(-1, ring.getMinimumSubscriberSequence());
+
+  // Both subscribers gate the publisher at -1; free both slots.
+  stalled.reset();
+  EXPECT_TRUE(ring.evictSubscriber(dead.getSlot()));
+  EXPECT_FALSE(ring.evictSubscriber(dead.getSlot()));
+  EXPECT_EQ(0, ring.getActiveSubscriberCount());
+  publish(ring, 8);
+  EXPECT_EQ(8, ring.getCursor());
+}
+
+TEST(BroadcastRingTest, shouldBroadcastToAnotherProcess) {
+  const std::string name = segmentName("fork");
+  RingT ring = RingT::create(name, 32, 2);
+  constexpr int64_t kEvents = 1000;
+
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    int status = 1;
+    try {
+      RingT mapping = RingT::open(name);
+      SubscriberT subscriber(mapping);
+      status = consume(subscriber, kEvents) == kEvents ? 0 : 2;
+    } catch (...) {
+      status = 3;
+    }
+    ::_exit(status);
+  }
+
+  while (ring.getActiveSubscriberCount() == 0) {
+    std::this_thread::yield();
+  }
+  for (int64_t i = 0; i < kEvents; ++i) {
+    publish(ring, i);
+  }
+  int status = -1;
+  ASSERT_EQ(child, ::waitpid(child, &status, 0));
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+}
+
+TEST(BroadcastRingTest, shouldRejectMismatchedOrMissingSegments) {
+  const std::string name = segmentName("validate");
+  EXPECT_THROW(RingT::open(name), std::system_error);
+  EXPECT_THROW(RingT::create(name, 12, 1), std::invalid_argument);
+
+  RingT ring = RingT::create(name, 8, 1);
+  EXPECT_THROW(RingT::create(name, 8, 1), std::system_error);
+  EXPECT_THROW(BroadcastRing<int64_t>::open(name), std::runtime_error);
+
+  SubscriberT only(ring);
+  EXPECT_THROW(SubscriberT{ring}, std::runtime_error);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace disruptor::test_support {
+
+inline constexpr std::chrono::seconds DEFAULT_AWAIT_TIMEOUT{10};
+
+// Yields until condition() holds or the timeout expires. Use as
+// ASSERT_TRUE(awaitCondition(...)) so a hung consumer fails the test instead
+// of hanging it.
+template <typename Condition>
+::testing::AssertionResult awaitCondition(Condition &&condition,
+                                          std::chrono::nanoseconds timeout = DEFAULT_AWAIT_TIMEOUT) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return ::testing::AssertionFailure() << "timed out";
+    }
+    std::this_thread::yield();
+  }
+  return ::testing::AssertionSuccess();
+}
+
+inline ::testing::AssertionResult awaitCount(const std::atomic<int64_t> &count, int64_t expected,
+                                             std::chrono::nanoseconds timeout = DEFAULT_AWAIT_TIMEOUT) {
+  return awaitCondition([&] { return count.load(std::memory_order_acquire) >= expected; }, timeout)
+         << " waiting for count " << expected << ", reached " << count.load(std::memory_order_acquire);
+}
+
+// Waits on anything with get() (Sequence) or getCursor() (RingBuffer).
+template <typename SequenceT>
+::testing::AssertionResult awaitSequence(const SequenceT &sequence, int64_t expected,
+                                         std::chrono::nanoseconds timeout = DEFAULT_AWAIT_TIMEOUT) {
+  auto current = [&sequence] {
+    if constexpr (requires { sequence.getCursor(); }) {
+      return sequence.getCursor();
+    } else {
+      return sequence.get();
+    }
+  };
+  return awaitCondition([&] { return current() >= expected; }, timeout)
+         << " waiting for sequence " << expected << ", reached " << current();
+}
+
+} // namespace disruptor::test_support
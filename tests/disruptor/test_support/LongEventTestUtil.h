@@ -0,0 +1,57 @@
+#pragma once
+
+#include "disruptor/EventHandler.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace disruptor::test_support {
+
+// Records the value and sequence of every LongEvent it handles, optionally
+// sleeping first to simulate a slow consumer.
+class RecordingHandler final : public EventHandler<support::LongEvent> {
+public:
+  explicit RecordingHandler(std::chrono::microseconds delay = std::chrono::microseconds(0)) : delay_(delay) {}
+
+  void onEvent(support::LongEvent &event, int64_t sequence, bool /*endOfBatch*/) override {
+    if (delay_.count() > 0) {
+      std::this_thread::sleep_for(delay_);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    values_.push_back(event.get());
+    sequences_.push_back(sequence);
+    count.fetch_add(1, std::memory_order_release);
+  }
+
+  std::vector<int64_t> values() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return values_;
+  }
+
+  std::vector<int64_t> sequences() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sequences_;
+  }
+
+  std::atomic<int64_t> count{0};
+
+private:
+  std::chrono::microseconds delay_;
+  std::mutex mutex_;
+  std::vector<int64_t> values_;
+  std::vector<int64_t> sequences_;
+};
+
+template <typename RingBufferT>
+void publish(RingBufferT &ringBuffer, int64_t value) {
+  const int64_t sequence = ringBuffer.next();
+  ringBuffer.get(sequence).set(value);
+  ringBuffer.publish(sequence);
+}
+
+} // namespace disruptor::test_support
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/util/LatencyHistogram.h"
+
+#include <cstdint>
+#include <thread>
+
+using disruptor::util::LatencyHistogram;
+
+TEST(LatencyHistogramTest, shouldRecordSmallValuesExactly) {
+  LatencyHistogram histogram;
+  for (int64_t i = 1; i <= 50; ++i) {
+    histogram.record(i);
+  }
+
+  EXPECT_EQ(50, histogram.getTotalCount());
+  EXPECT_EQ(1, histogram.getMin());
+  EXPECT_EQ(50, histogram.getMax());
+  EXPECT_DOUBLE_EQ(25.5, histogram.getMean());
+  EXPECT_EQ(25, histogram.getValueAtPercentile(50.0));
+  EXPECT_EQ(50, histogram.getValueAtPercentile(100.0));
+}
+
+TEST(LatencyHistogramTest, shouldKeepRelativeErrorBoundedForLargeValues) {
+  LatencyHistogram histogram;
+  const int64_t value = 1'234'567;
+  histogram.record(value);
+
+  const int64_t reported = histogram.getValueAtPercentile(99.0);
+  EXPECT_LE(reported, value);
+  EXPECT_GE(reported, value - value / LatencyHistogram::SUB_BUCKET_COUNT);
+}
+
+TEST(LatencyHistogramTest, shouldMapBucketBoundsConsistently) {
+  for (uint64_t v : {0ull, 63ull, 64ull, 65ull, 1000ull, 1ull << 40, ~0ull}) {
+    const int index = LatencyHistogram::bucketIndex(v);
+    ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+    EXPECT_LE(LatencyHistogram::lowestEquivalentValue(index), v);
+    EXPECT_GE(LatencyHistogram::highestEquivalentValue(index), v);
+  }
+}
+
+TEST(LatencyHistogramTest, shouldClampNegativeValuesToZero) {
+  LatencyHistogram histogram;
+  histogram.record(-5);
+  EXPECT_EQ(1, histogram.getCountAtIndex(0));
+  EXPECT_EQ(0, histogram.getMax());
+}
+
+TEST(LatencyHistogramTest, shouldBeReadableWhileWriterIsRecording) {
+  LatencyHistogram histogram;
+  constexpr int64_t COUNT = 200'000;
+
+  std::thread writer([&] {
+    for (int64_t i = 0; i < COUNT; ++i) {
+      histogram.record(i & 1023);
+    }
+  });
+
+  int64_t lastCount = 0;
+  while (lastCount < COUNT) {
+    const int64_t count = histogram.getTotalCount();
+    ASSERT_GE(count, lastCount);
+    lastCount = count;
+    histogram.getValueAtPercentile(99.0);
+    std::this_thread::yield();
+  }
+  writer.join();
+
+  EXPECT_EQ(COUNT, histogram.getTotalCount());
+  EXPECT_EQ(1023, histogram.getMax());
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BatchEventProcessorMetrics.h"
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/RingBufferTracing.h"
+#include "disruptor/util/SequenceTracer.h"
+#include "tests/disruptor/support/StubEvent.h"
+#include "tests/disruptor/test_support/CountDownLatch.h"
+
+#include <stdexcept>
+#include <thread>
+
+using disruptor::util::SequenceTracer;
+
+namespace {
+class CountingHandler final : public disruptor::EventHandler<disruptor::support::StubEvent> {
+public:
+  explicit CountingHandler(disruptor::test_support::CountDownLatch* latch = nullptr) : latch_(latch) {}
+
+  void onEvent(disruptor::support::StubEvent& /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    if (latch_ != nullptr) {
+      latch_->countDown();
+    }
+  }
+
+private:
+  disruptor::test_support::CountDownLatch* latch_;
+};
+} // namespace
+
+TEST(SequenceTracerTest, shouldOnlySampleEveryNthSequence) {
+  SequenceTracer tracer(16, 4, 1);
+  EXPECT_TRUE(tracer.isSampled(0));
+  EXPECT_FALSE(tracer.isSampled(1));
+  EXPECT_FALSE(tracer.isSampled(3));
+  EXPECT_TRUE(tracer.isSampled(4));
+}
+
+TEST(SequenceTracerTest, shouldRejectInvalidConfiguration) {
+  EXPECT_THROW(SequenceTracer(12, 4, 1), std::invalid_argument);
+  EXPECT_THROW(SequenceTracer(16, 3, 1), std::invalid_argument);
+  EXPECT_THROW(SequenceTracer(16, 4, 0), std::invalid_argument);
+}
+
+TEST(SequenceTracerTest, shouldOnlyReportCompleteSamples) {
+  SequenceTracer tracer(16, 2, 2);
+  tracer.onClaim(0, 3);
+  tracer.onPublish(0, 3);
+  tracer.onStage(0, 0);
+  tracer.onStage(1, 0);
+  tracer.onStage(0, 2);  // sequence 2 never reaches stage 1
+
+  auto report = tracer.report();
+  EXPECT_EQ(3, report.getSegmentCount());
+  EXPECT_EQ(1, report.getSampleCount());
+  EXPECT_EQ(1, report.getSegment(0).getTotalCount());
+  EXPECT_EQ(1, report.getSegment(2).getTotalCount());
+}
+
+TEST(SequenceTracerTest, shouldIgnoreStampsForRecycledRecords) {
+  SequenceTracer tracer(2, 1, 1);
+  tracer.onClaim(0, 0);
+  tracer.onClaim(2, 2);  // reuses the record of sequence 0
+  tracer.onPublish(0, 0);
+  tracer.onStage(0, 0);
+
+  EXPECT_EQ(0, tracer.report().getSampleCount());
+}
+
+TEST(SequenceTracerTest, shouldBreakDownLatencyAcrossProcessorStages) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BlockingWaitStrategy;
+  using RB = disruptor::SingleProducerRingBuffer<Event, WS, disruptor::RingBufferSequenceTracing>;
+  constexpr int PUBLISH_COUNT = 64;
+
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::EVENT_FACTORY, 16, ws);
+  SequenceTracer tracer(64, 4, 2);
+  ringBuffer->getTracing().attach(tracer);
+
+  disruptor::test_support::CountDownLatch latch(PUBLISH_COUNT);
+  CountingHandler first;
+  CountingHandler second(&latch);
+
+  disruptor::BatchEventProcessorBuilder builder;
+  auto firstBarrier = ringBuffer->newBarrier(nullptr, 0);
+  auto stage0 = builder.build<disruptor::SequenceTracingMetrics>(*ringBuffer, *firstBarrier, first);
+  disruptor::Sequence* afterFirst[] = {&stage0->getSequence()};
+  auto secondBarrier = ringBuffer->newBarrier(afterFirst, 1);
+  auto stage1 = builder.build<disruptor::SequenceTracingMetrics>(*ringBuffer, *secondBarrier, second);
+  stage0->getMetrics().attach(tracer, 0);
+  stage1->getMetrics().attach(tracer, 1);
+  ringBuffer->addGatingSequences(stage1->getSequence());
+
+  std::thread t0([&] { stage0->run(); });
+  std::thread t1([&] { stage1->run(); });
+  for (int i = 0; i < PUBLISH_COUNT; ++i) {
+    ringBuffer->publish(ringBuffer->next());
+  }
+  latch.await();
+  stage0->halt();
+  stage1->halt();
+  t0.join();
+  t1.join();
+
+  auto report = tracer.report();
+  EXPECT_EQ(PUBLISH_COUNT / 4, report.getSampleCount());
+  for (int segment = 0; segment < report.getSegmentCount(); ++segment) {
+    EXPECT_EQ(PUBLISH_COUNT / 4, report.getSegment(segment).getTotalCount());
+  }
+  EXPECT_GE(report.getEndToEnd().getMin(), report.getSegment(2).getMin());
+}